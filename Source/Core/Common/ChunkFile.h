@@ -240,6 +240,20 @@ public:
     return previous_pointer;
   }
 
+  // Skips over size bytes without touching them, and returns a pointer to them so that the caller
+  // can fill them in later. Returns nullptr unless the bytes were reserved in write mode.
+  [[nodiscard]] u8* ReserveBytes(u32 size)
+  {
+    u8* previous_pointer = *m_ptr_current;
+    *m_ptr_current += size;
+    if (!IsMeasureMode() && *m_ptr_current > m_ptr_end)
+    {
+      // trying to read/write past the end of the buffer, prevent this
+      SetMeasureMode();
+    }
+    return IsWriteMode() ? previous_pointer : nullptr;
+  }
+
   u32 GetOffsetFromPreviousPosition(u8* previous_pointer)
   {
     return static_cast<u32>((*m_ptr_current) - previous_pointer);
@@ -3,28 +3,48 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cstring>
-#include <memory>
+#include <functional>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
-#include "Common/Version.h"
+#include "Common/MappedFile.h"
 
 // On disk format:
 // header{
-// u32 'DCAC';
-// u32 version;  // svn_rev
+// u32 'DCA2';
+// u32 entry_version;  // chosen by the owner of the cache
 // u16 sizeof(key_type);
 // u16 sizeof(value_type);
 //}
 
-// key_value_pair{
+// Followed by any number of entries and index blocks, in the order they were written.
+
+// entry{
 // u32 value_size;
 // key_type   key;
 // value_type[value_size]   value;
+// u32 entry_number;  // counts all entries in the file starting from 1, catches torn writes
+//}
+
+// index{
+// u32 num_index_entries | INDEX_FLAG;
+// index_entry{
+//   u64 entry_offset;
+//   u32 value_size;
+//   key_type key;
+// }[num_index_entries]
+// u64 index_offset;  // offset of this index block
+// u32 num_entries;   // entry_number of the last entry before this index block
+// u32 'DIDX';
 //}
 
 namespace Common
@@ -36,12 +56,20 @@ public:
   virtual void Read(const K& key, const V* value, u32 value_size) = 0;
 };
 
-// Dead simple unsorted key-value store with append functionality.
-// No random read functionality, all reading is done in OpenAndRead.
+// Unsorted key-value store with append functionality.
 // Keys and values can contain any characters, including \0.
 //
+// The file is memory mapped when opened, and an index of the latest entry for each key is written
+// on Close. If the file ends with such an index, opening it only reads the index; otherwise the
+// entry headers are walked to rebuild it. Values are never read before they are looked up, and
+// files where superseded entries and stale indices take up a large part of the file are compacted
+// when opened.
+//
+// Instead of the build's revision, the header stores a version chosen by the owner of the cache,
+// which should be changed whenever the meaning of existing keys or values changes. Files with a
+// different version are discarded.
+//
 // Suitable for caching generated shader bytecode between executions.
-// Not tuned for extreme performance but should be reasonably fast.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
 
@@ -52,117 +80,378 @@ template <typename K, typename V>
 class LinearDiskCache
 {
 public:
-  // return number of read entries
-  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
-  {
-    // Since we're reading/writing directly to the storage of K instances,
-    // K must be trivially copyable.
-    static_assert(std::is_trivially_copyable<K>::value, "K must be a trivially copyable type");
+  // Since we're reading/writing directly to the storage of K instances,
+  // K must be trivially copyable.
+  static_assert(std::is_trivially_copyable_v<K>, "K must be a trivially copyable type");
+  static_assert(alignof(V) == 1, "Values are read in place from the mapped file");
 
-    // close any currently opened file
-    Close();
-    m_num_entries = 0;
+  LinearDiskCache() = default;
+  ~LinearDiskCache() { Close(); }
 
-    // try opening for reading/writing
-    m_file.Open(filename, "r+b");
+  LinearDiskCache(const LinearDiskCache&) = delete;
+  LinearDiskCache& operator=(const LinearDiskCache&) = delete;
 
-    const u64 file_size = m_file.GetSize();
+  // Opens or creates the file without reading any values. Returns false if there was no usable
+  // existing file, in which case an empty one was created.
+  bool Open(const std::string& filename, u32 entry_version = 0)
+  {
+    // close any currently opened file
+    Close();
 
-    m_header.Init();
-    if (m_file.IsOpen() && ValidateHeader())
+    m_header.Init(entry_version);
+    if (m_mapping.Open(filename) && ValidateHeader())
     {
-      // good header, read some key/value pairs
-      K key;
+      if (!LoadIndex())
+        ScanEntries();
 
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
+      if (ShouldCompact())
+        Compact(filename);
 
-      while (m_file.ReadArray(&value_size, 1))
-      {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
+      // Anything past the last complete entry may be overwritten by appended entries
+      m_mapped_end = m_valid_end;
 
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
-
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
-        {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
-        {
-          break;
-        }
-
-        m_num_entries++;
-      }
-      m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
-
-      return m_num_entries;
+      // try opening for reading/writing
+      if (m_file.Open(filename, "r+b") && m_file.Seek(m_valid_end, File::SeekOrigin::Begin))
+        return true;
     }
 
     // failed to open file for reading or bad header
     // close and recreate file
+    m_index_dirty = false;
     Close();
     m_file.Open(filename, "wb");
     WriteHeader();
-    return 0;
+    m_valid_end = sizeof(Header);
+    return false;
+  }
+
+  // Opens or creates the file and passes the latest value of every key to the reader.
+  // Returns the number of read entries.
+  u32 OpenAndRead(const std::string& filename, LinearDiskCacheReader<K, V>& reader,
+                  u32 entry_version = 0)
+  {
+    if (!Open(filename, entry_version))
+      return 0;
+
+    for (const Entry& entry : m_entries)
+      reader.Read(entry.key, GetMappedValue(entry), entry.value_size);
+
+    return static_cast<u32>(m_entries.size());
   }
 
+  // Returns the latest value stored for the key, read in place from the mapped file. Only entries
+  // which were in the file when it was opened can be looked up. The returned data is valid until
+  // the cache is closed.
+  std::optional<std::span<const V>> Find(const K& key) const
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+      return std::nullopt;
+
+    const Entry& entry = m_entries[it->second];
+    const V* value = GetMappedValue(entry);
+    if (!value)
+      return std::nullopt;
+
+    return std::span<const V>(value, entry.value_size);
+  }
+
+  bool Contains(const K& key) const { return m_index.contains(key); }
+
   void Sync() { m_file.Flush(); }
   void Close()
   {
+    m_mapping.Close();
+
     if (m_file.IsOpen())
+    {
+      if (m_index_dirty)
+      {
+        WriteIndex(m_file, m_entries, m_num_entries);
+        // Drop anything left over from an entry that was only partially written
+        m_file.Flush();
+        m_file.Resize(m_file.Tell());
+      }
       m_file.Close();
+    }
+
+    m_entries.clear();
+    m_index.clear();
+    m_num_entries = 0;
+    m_valid_end = 0;
+    m_mapped_end = 0;
+    m_index_dirty = false;
   }
 
-  // Appends a key-value pair to the store.
+  // Appends a key-value pair to the store. An existing entry for the key is superseded, unless it
+  // already holds the same value, in which case nothing is written.
   void Append(const K& key, const V* value, u32 value_size)
   {
-    // TODO: Should do a check that we don't already have "key"? (I think each caller does that
-    // already.)
+    if (const auto it = m_index.find(key); it != m_index.end())
+    {
+      const Entry& entry = m_entries[it->second];
+      const V* existing_value = GetMappedValue(entry);
+      if (existing_value && entry.value_size == value_size &&
+          (value_size == 0 || std::memcmp(existing_value, value, value_size * sizeof(V)) == 0))
+      {
+        return;
+      }
+    }
+
+    const u64 offset = m_file.Tell();
     m_file.WriteArray(&value_size, 1);
     m_file.WriteArray(&key, 1);
     m_file.WriteArray(value, value_size);
     m_num_entries++;
     m_file.WriteArray(&m_num_entries, 1);
+
+    AddEntry(key, offset, value_size);
+    m_index_dirty = true;
   }
 
 private:
+  static constexpr u32 INDEX_FLAG = 0x80000000;
+  static constexpr u32 INDEX_MAGIC = 0x58444944;  // DIDX
+  static constexpr u64 INDEX_ENTRY_SIZE = sizeof(u64) + sizeof(u32) + sizeof(K);
+  static constexpr u64 INDEX_FOOTER_SIZE = sizeof(u64) + sizeof(u32) + sizeof(u32);
+
+  struct Entry
+  {
+    K key;
+    u64 offset;  // of the entry, not the value
+    u32 value_size;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(const K& key) const
+    {
+      return std::hash<std::string_view>{}(
+          std::string_view(reinterpret_cast<const char*>(&key), sizeof(K)));
+    }
+  };
+
+  struct KeyEqual
+  {
+    bool operator()(const K& a, const K& b) const { return std::memcmp(&a, &b, sizeof(K)) == 0; }
+  };
+
+  static constexpr u64 GetEntrySize(u32 value_size)
+  {
+    return sizeof(u32) + sizeof(K) + u64{value_size} * sizeof(V) + sizeof(u32);
+  }
+
+  static constexpr u64 GetIndexSize(u32 num_index_entries)
+  {
+    return sizeof(u32) + num_index_entries * INDEX_ENTRY_SIZE + INDEX_FOOTER_SIZE;
+  }
+
+  template <typename T>
+  static T ReadMapped(const u8* data)
+  {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  // Returns nullptr for entries appended after the file was mapped. Those can also lie within the
+  // mapping when garbage after the last complete entry was overwritten, in which case the mapping
+  // may hold stale data or data which hasn't been flushed yet.
+  const V* GetMappedValue(const Entry& entry) const
+  {
+    if (entry.offset + GetEntrySize(entry.value_size) > m_mapped_end)
+      return nullptr;
+    return reinterpret_cast<const V*>(m_mapping.GetData() + entry.offset + sizeof(u32) +
+                                      sizeof(K));
+  }
+
+  void AddEntry(const K& key, u64 offset, u32 value_size)
+  {
+    const auto [it, inserted] = m_index.try_emplace(key, m_entries.size());
+    if (inserted)
+      m_entries.push_back({key, offset, value_size});
+    else
+      m_entries[it->second] = {key, offset, value_size};
+  }
+
   void WriteHeader() { m_file.WriteArray(&m_header, 1); }
   bool ValidateHeader()
   {
-    char file_header[sizeof(Header)];
+    return m_mapping.GetSize() >= sizeof(Header) &&
+           !std::memcmp(&m_header, m_mapping.GetData(), sizeof(Header));
+  }
+
+  // Loads the index at the end of the file, if there is one
+  bool LoadIndex()
+  {
+    const u8* const data = m_mapping.GetData();
+    const u64 size = m_mapping.GetSize();
+    if (size < sizeof(Header) + GetIndexSize(0))
+      return false;
+
+    const u8* const footer = data + size - INDEX_FOOTER_SIZE;
+    const u64 index_offset = ReadMapped<u64>(footer);
+    const u32 num_entries = ReadMapped<u32>(footer + sizeof(u64));
+    if (ReadMapped<u32>(footer + sizeof(u64) + sizeof(u32)) != INDEX_MAGIC ||
+        index_offset < sizeof(Header) || index_offset > size - GetIndexSize(0))
+    {
+      return false;
+    }
 
-    return (m_file.ReadArray(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+    const u32 index_word = ReadMapped<u32>(data + index_offset);
+    const u32 num_index_entries = index_word & ~INDEX_FLAG;
+    if (!(index_word & INDEX_FLAG) || index_offset + GetIndexSize(num_index_entries) != size)
+      return false;
+
+    const u8* index_entry = data + index_offset + sizeof(u32);
+    for (u32 i = 0; i < num_index_entries; i++, index_entry += INDEX_ENTRY_SIZE)
+    {
+      const u64 offset = ReadMapped<u64>(index_entry);
+      const u32 value_size = ReadMapped<u32>(index_entry + sizeof(u64));
+      const K key = ReadMapped<K>(index_entry + sizeof(u64) + sizeof(u32));
+      if (offset < sizeof(Header) || offset > index_offset ||
+          GetEntrySize(value_size) > index_offset - offset)
+      {
+        m_entries.clear();
+        m_index.clear();
+        return false;
+      }
+      AddEntry(key, offset, value_size);
+    }
+
+    m_num_entries = num_entries;
+    m_valid_end = size;
+    m_index_dirty = false;
+    return true;
+  }
+
+  // Rebuilds the index from the entries, stopping at the first one that is incomplete
+  void ScanEntries()
+  {
+    const u8* const data = m_mapping.GetData();
+    const u64 size = m_mapping.GetSize();
+    u64 offset = sizeof(Header);
+
+    while (size - offset >= sizeof(u32))
+    {
+      const u32 word = ReadMapped<u32>(data + offset);
+      if (word & INDEX_FLAG)
+      {
+        // Stale index, everything in it is also found by walking the entries
+        const u64 index_size = GetIndexSize(word & ~INDEX_FLAG);
+        if (index_size > size - offset)
+          break;
+        offset += index_size;
+        continue;
+      }
+
+      const u64 entry_size = GetEntrySize(word);
+      if (entry_size > size - offset ||
+          ReadMapped<u32>(data + offset + entry_size - sizeof(u32)) != m_num_entries + 1)
+      {
+        break;
+      }
+
+      AddEntry(ReadMapped<K>(data + offset + sizeof(u32)), offset, word);
+      m_num_entries++;
+      offset += entry_size;
+    }
+
+    m_valid_end = offset;
+    m_index_dirty = true;
+  }
+
+  // Compacting is worth it once more than a quarter of the file is superseded entries, stale
+  // indices or garbage from incomplete writes
+  bool ShouldCompact() const
+  {
+    u64 used_size = sizeof(Header);
+    if (!m_index_dirty)
+      used_size += GetIndexSize(static_cast<u32>(m_entries.size()));
+    for (const Entry& entry : m_entries)
+      used_size += GetEntrySize(entry.value_size);
+
+    return (m_mapping.GetSize() - used_size) * 4 > m_mapping.GetSize();
+  }
+
+  // Rewrites the file with only the latest entry for each key, followed by an index
+  void Compact(const std::string& filename)
+  {
+    const std::string temp_filename = filename + ".tmp";
+    std::vector<Entry> entries = m_entries;
+    u32 num_entries = 0;
+
+    File::IOFile temp_file(temp_filename, "wb");
+    temp_file.WriteArray(&m_header, 1);
+    for (Entry& entry : entries)
+    {
+      const u64 offset = temp_file.Tell();
+      temp_file.WriteBytes(m_mapping.GetData() + entry.offset,
+                           GetEntrySize(entry.value_size) - sizeof(u32));
+      num_entries++;
+      temp_file.WriteArray(&num_entries, 1);
+      entry.offset = offset;
+    }
+    WriteIndex(temp_file, entries, num_entries);
+    const bool written = temp_file.IsGood();
+    temp_file.Close();
+
+    // The mapping has to be closed before the file can be replaced on Windows
+    m_mapping.Close();
+    if (written && File::Rename(temp_filename, filename))
+    {
+      m_entries = std::move(entries);
+      m_num_entries = num_entries;
+      m_index_dirty = false;
+    }
+    else
+    {
+      File::Delete(temp_filename);
+    }
+
+    m_mapping.Open(filename);
+    m_valid_end = m_index_dirty ? m_valid_end : m_mapping.GetSize();
+  }
+
+  static void WriteIndex(File::IOFile& file, std::span<const Entry> entries, u32 num_entries)
+  {
+    const u64 index_offset = file.Tell();
+    const u32 index_word = static_cast<u32>(entries.size()) | INDEX_FLAG;
+    file.WriteArray(&index_word, 1);
+    for (const Entry& entry : entries)
+    {
+      file.WriteArray(&entry.offset, 1);
+      file.WriteArray(&entry.value_size, 1);
+      file.WriteArray(&entry.key, 1);
+    }
+    file.WriteArray(&index_offset, 1);
+    file.WriteArray(&num_entries, 1);
+    file.WriteArray(&INDEX_MAGIC, 1);
   }
 
   struct Header
   {
-    void Init()
+    void Init(u32 version)
     {
       // Null-terminator is intentionally not copied.
-      std::memcpy(&id, "DCAC", sizeof(u32));
-      std::memcpy(ver, Common::GetScmRevGitStr().c_str(),
-                  std::min(Common::GetScmRevGitStr().size(), sizeof(ver)));
+      std::memcpy(&id, "DCA2", sizeof(u32));
+      entry_version = version;
     }
 
     u32 id = 0;
-    const u16 key_t_size = sizeof(K);
-    const u16 value_t_size = sizeof(V);
-    char ver[40] = {};
-
+    u32 entry_version = 0;
+    u16 key_t_size = sizeof(K);
+    u16 value_t_size = sizeof(V);
   } m_header;
 
   File::IOFile m_file;
+  File::MappedFile m_mapping;
+  std::vector<Entry> m_entries;
+  std::unordered_map<K, size_t, KeyHash, KeyEqual> m_index;
   u32 m_num_entries = 0;
+  u64 m_valid_end = 0;
+  // The end of the complete entries at the time the file was mapped
+  u64 m_mapped_end = 0;
+  bool m_index_dirty = false;
 };
 }  // namespace Common
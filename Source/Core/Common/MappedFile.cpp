@@ -0,0 +1,127 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+MappedFile::MappedFile() = default;
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const HANDLE file = CreateFileW(UTF8ToWString(filename).c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // Empty files can't be mapped, but are still valid
+  if (size.QuadPart != 0)
+  {
+    m_mapping_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping_handle)
+      m_data = static_cast<const u8*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+
+    if (!m_data)
+    {
+      if (m_mapping_handle)
+        CloseHandle(m_mapping_handle);
+      m_mapping_handle = nullptr;
+      CloseHandle(file);
+      return false;
+    }
+  }
+
+  // The mapping keeps its own reference to the file
+  CloseHandle(file);
+  m_size = static_cast<u64>(size.QuadPart);
+  m_open = true;
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping_handle)
+    CloseHandle(m_mapping_handle);
+  m_mapping_handle = nullptr;
+  m_data = nullptr;
+  m_size = 0;
+  m_open = false;
+}
+#else
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  // Empty files can't be mapped, but are still valid
+  if (st.st_size != 0)
+  {
+    void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      close(fd);
+      return false;
+    }
+    m_data = static_cast<const u8*>(data);
+  }
+
+  // The mapping keeps its own reference to the file
+  close(fd);
+  m_size = static_cast<u64>(st.st_size);
+  m_open = true;
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), m_size);
+  m_data = nullptr;
+  m_size = 0;
+  m_open = false;
+}
+#endif
+}  // namespace File
@@ -0,0 +1,41 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+// Read-only memory mapping of a whole file. The mapping covers the file as it was when Open was
+// called; data appended afterwards is only visible after reopening.
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  bool Open(const std::string& filename);
+  void Close();
+
+  bool IsOpen() const { return m_open; }
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+
+private:
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+  bool m_open = false;
+
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+};
+}  // namespace File
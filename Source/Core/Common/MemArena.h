@@ -53,6 +53,13 @@ public:
   ///
   void GrabSHMSegment(size_t size, std::string_view base_name);
 
+  ///
+  /// Back the views created from now on with transparent huge pages where the OS supports it, and
+  /// align the memory region reserved with ReserveMemoryRegion() for them. Only has an effect on
+  /// Linux.
+  ///
+  void EnableHugePages();
+
   ///
   /// Release the memory segment previously allocated with GrabSHMSegment().
   /// Should not be called before all views have been released.
@@ -135,6 +142,7 @@ private:
   int m_shm_fd = 0;
   void* m_reserved_region = nullptr;
   std::size_t m_reserved_region_size = 0;
+  bool m_huge_pages = false;
 #endif
 };
 
@@ -73,6 +73,11 @@ void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
     NOTICE_LOG_FMT(MEMMAP, "Ashmem allocation failed");
 }
 
+void MemArena::EnableHugePages()
+{
+  // ashmem doesn't support huge pages.
+}
+
 void MemArena::ReleaseSHMSegment()
 {
   close(m_shm_fd);
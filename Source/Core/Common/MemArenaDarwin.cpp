@@ -42,6 +42,12 @@ void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
   m_shm_size = size;
 }
 
+void MemArena::EnableHugePages()
+{
+  // macOS only uses superpages for memory allocated with VM_FLAGS_SUPERPAGE_SIZE_2MB, which can't
+  // be remapped.
+}
+
 void MemArena::ReleaseSHMSegment()
 {
   if (m_shm_entry != MACH_PORT_NULL)
@@ -16,32 +16,76 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
 namespace Common
 {
+// The size of a PMD mapped transparent huge page on x86-64, and on AArch64 with 4 KiB pages.
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
 MemArena::MemArena() = default;
 MemArena::~MemArena() = default;
 
 void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
 {
   const std::string file_name = fmt::format("/{}.{}", base_name, getpid());
-  m_shm_fd = shm_open(file_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
-  if (m_shm_fd == -1)
+  int fd = -1;
+#ifdef __linux__
+  // shm_open creates the segment on the /dev/shm mount, whose huge= mount option decides about
+  // huge pages and defaults to never. memfd_create uses the kernel's internal shmem mount instead,
+  // which follows /sys/kernel/mm/transparent_hugepage/shmem_enabled.
+  if (m_huge_pages)
+  {
+    fd = memfd_create(file_name.c_str() + 1, MFD_CLOEXEC);
+    if (fd == -1)
+      WARN_LOG_FMT(MEMMAP, "memfd_create failed: {}", strerror(errno));
+  }
+#endif
+  if (fd != -1)
   {
-    ERROR_LOG_FMT(MEMMAP, "shm_open failed: {}", strerror(errno));
-    return;
+    m_shm_fd = fd;
+  }
+  else
+  {
+    m_shm_fd = shm_open(file_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (m_shm_fd == -1)
+    {
+      ERROR_LOG_FMT(MEMMAP, "shm_open failed: {}", strerror(errno));
+      return;
+    }
+    shm_unlink(file_name.c_str());
   }
-  shm_unlink(file_name.c_str());
   if (ftruncate(m_shm_fd, size) < 0)
     ERROR_LOG_FMT(MEMMAP, "Failed to allocate low memory space");
 }
 
+void MemArena::EnableHugePages()
+{
+  m_huge_pages = true;
+
+#ifdef __linux__
+  // Shared memory only uses transparent huge pages if the administrator allows it, so tell the
+  // user why nothing happens otherwise.
+  std::string shmem_enabled;
+  if (File::ReadFileToString("/sys/kernel/mm/transparent_hugepage/shmem_enabled", shmem_enabled) &&
+      (shmem_enabled.find("[never]") != std::string::npos ||
+       shmem_enabled.find("[deny]") != std::string::npos))
+  {
+    WARN_LOG_FMT(MEMMAP, "Huge pages for emulated memory are disabled by the system. Set "
+                         "/sys/kernel/mm/transparent_hugepage/shmem_enabled to advise to use "
+                         "them.");
+  }
+#endif
+}
+
 void MemArena::ReleaseSHMSegment()
 {
   close(m_shm_fd);
@@ -57,6 +101,8 @@ void* MemArena::CreateView(s64 offset, size_t size)
   }
   else
   {
+    if (m_huge_pages && !AdviseHugePages(retval, size))
+      m_huge_pages = false;
     return retval;
   }
 }
@@ -68,13 +114,28 @@ void MemArena::ReleaseView(void* view, size_t size)
 
 u8* MemArena::ReserveMemoryRegion(size_t memory_size)
 {
+  // Huge pages can only be used where the address is aligned like the offset in the segment is,
+  // so align the region and trim the excess.
+  const size_t alignment = m_huge_pages ? HUGE_PAGE_SIZE : 0;
+
   const int flags = MAP_ANON | MAP_PRIVATE;
-  void* base = mmap(nullptr, memory_size, PROT_NONE, flags, -1, 0);
+  void* base = mmap(nullptr, memory_size + alignment, PROT_NONE, flags, -1, 0);
   if (base == MAP_FAILED)
   {
     PanicAlertFmt("Failed to map enough memory space: {}", LastStrerrorString());
     return nullptr;
   }
+  if (alignment != 0)
+  {
+    u8* const unaligned_base = static_cast<u8*>(base);
+    u8* const aligned_base = reinterpret_cast<u8*>(
+        Common::AlignUp(reinterpret_cast<uintptr_t>(unaligned_base), alignment));
+    const size_t head_size = aligned_base - unaligned_base;
+    if (head_size != 0)
+      munmap(unaligned_base, head_size);
+    munmap(aligned_base + memory_size, alignment - head_size);
+    base = aligned_base;
+  }
   m_reserved_region = base;
   m_reserved_region_size = memory_size;
   return static_cast<u8*>(base);
@@ -99,6 +160,8 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
   }
   else
   {
+    if (m_huge_pages && !AdviseHugePages(retval, size))
+      m_huge_pages = false;
     return retval;
   }
 }
@@ -125,6 +125,12 @@ void MemArena::GrabSHMSegment(size_t size, std::string_view base_name)
                         GetLowDWORD(size), UTF8ToTStr(name).c_str());
 }
 
+void MemArena::EnableHugePages()
+{
+  // Large pages require the SeLockMemoryPrivilege and can't back views of a file mapping that
+  // are split like ours are.
+}
+
 void MemArena::ReleaseSHMSegment()
 {
   if (!m_memory_handle)
@@ -257,6 +257,20 @@ bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute)
   return true;
 }
 
+bool AdviseHugePages(void* ptr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+  {
+    WARN_LOG_FMT(MEMMAP, "Failed to enable huge pages: {}", LastStrerrorString());
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
 size_t MemPhysical()
 {
 #ifdef _WIN32
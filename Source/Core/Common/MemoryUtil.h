@@ -33,6 +33,9 @@ void FreeAlignedMemory(void* ptr);
 bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
+// Asks the OS to back the given range with transparent huge pages. Returns false if the OS doesn't
+// support it, in which case regular pages keep being used.
+bool AdviseHugePages(void* ptr, size_t size);
 size_t MemPhysical();
 
 }  // namespace Common
@@ -29,6 +29,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
+#include "Common/Tracer.h"
 
 namespace Common
 {
@@ -114,6 +115,7 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  Tracer::SetThreadName(name);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -184,6 +186,7 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+  Tracer::SetThreadName(name);
 }
 
 std::tuple<void*, size_t> GetCurrentThreadStack()
@@ -0,0 +1,339 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Tracer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace Common::Tracer
+{
+namespace
+{
+// Duration of events recorded by Instant().
+constexpr u64 INSTANT_EVENT = ~u64{0};
+
+struct Event
+{
+  const char* name;
+  const char* category;
+  u64 start;
+  u64 duration;
+};
+
+// Events are stored in fixed size chunks, so that the buffer never moves while the exporting
+// thread reads it. This caps a trace at a few million events per thread, and the memory used by
+// all threads together at 512 MiB.
+constexpr size_t EVENTS_PER_CHUNK = 16384;
+constexpr size_t MAX_CHUNKS = 256;
+constexpr size_t MAX_TOTAL_CHUNKS = 1024;
+
+struct ThreadBuffer
+{
+  u32 thread_id = 0;
+  // Protected by s_mutex.
+  std::string name;
+  // Whether a thread is using the buffer. Protected by s_mutex. Buffers of exited threads are
+  // kept until their events have been written out, and then handed to new threads.
+  bool in_use = true;
+
+  // Trace the events belong to. Only the owning thread writes this and the events, and it resets
+  // the buffer when it notices a new trace was started.
+  std::atomic<u32> generation = 0;
+  std::array<std::unique_ptr<Event[]>, MAX_CHUNKS> chunks;
+  // Number of events written. Released after writing an event, so that readers which acquire it
+  // see the event.
+  std::atomic<size_t> count = 0;
+  std::atomic<u64> dropped = 0;
+};
+
+std::mutex s_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+std::set<std::string, std::less<>> s_interned_names;
+
+std::atomic<u32> s_generation = 0;
+std::atomic<size_t> s_num_chunks = 0;
+// Protected by s_mutex.
+u64 s_start_time = 0;
+thread_local std::string t_thread_name;
+
+// Gives the buffer back when the thread exits.
+struct ThreadBufferOwner
+{
+  ~ThreadBufferOwner()
+  {
+    if (!buffer)
+      return;
+    std::lock_guard lk(s_mutex);
+    buffer->in_use = false;
+  }
+
+  ThreadBuffer* buffer = nullptr;
+};
+thread_local ThreadBufferOwner t_owner;
+
+// Frees the events of exited threads. Must be called with s_mutex held, when those events are
+// not needed anymore.
+void FreeUnusedBuffers()
+{
+  for (const auto& buffer : s_buffers)
+  {
+    if (buffer->in_use)
+      continue;
+
+    for (std::unique_ptr<Event[]>& chunk : buffer->chunks)
+    {
+      if (chunk)
+        s_num_chunks.fetch_sub(1, std::memory_order_relaxed);
+      chunk.reset();
+    }
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+  }
+}
+
+ThreadBuffer* AcquireThreadBuffer()
+{
+  std::lock_guard lk(s_mutex);
+
+  // The buffers of threads which exited during the current trace may still hold events to write
+  // out.
+  const u32 generation = s_generation.load(std::memory_order_relaxed);
+  const auto it = std::ranges::find_if(s_buffers, [&](const auto& buffer) {
+    return !buffer->in_use && (buffer->generation.load(std::memory_order_relaxed) != generation ||
+                               buffer->count.load(std::memory_order_relaxed) == 0);
+  });
+  ThreadBuffer* buffer;
+  if (it != s_buffers.end())
+  {
+    buffer = it->get();
+  }
+  else
+  {
+    buffer = s_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+    buffer->thread_id = static_cast<u32>(s_buffers.size());
+  }
+  buffer->in_use = true;
+  buffer->name = t_thread_name;
+  return buffer;
+}
+
+ThreadBuffer* GetThreadBuffer()
+{
+  ThreadBuffer* buffer = t_owner.buffer;
+  if (!buffer) [[unlikely]]
+    buffer = t_owner.buffer = AcquireThreadBuffer();
+
+  const u32 generation = s_generation.load(std::memory_order_acquire);
+  if (buffer->generation.load(std::memory_order_relaxed) != generation) [[unlikely]]
+  {
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->generation.store(generation, std::memory_order_release);
+  }
+  return buffer;
+}
+
+void Push(const Event& event)
+{
+  ThreadBuffer* const buffer = GetThreadBuffer();
+  const size_t index = buffer->count.load(std::memory_order_relaxed);
+  const size_t chunk_index = index / EVENTS_PER_CHUNK;
+  if (chunk_index >= MAX_CHUNKS) [[unlikely]]
+  {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  std::unique_ptr<Event[]>& chunk = buffer->chunks[chunk_index];
+  if (!chunk) [[unlikely]]
+  {
+    if (s_num_chunks.fetch_add(1, std::memory_order_relaxed) >= MAX_TOTAL_CHUNKS)
+    {
+      s_num_chunks.fetch_sub(1, std::memory_order_relaxed);
+      buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    chunk = std::make_unique<Event[]>(EVENTS_PER_CHUNK);
+  }
+  chunk[index % EVENTS_PER_CHUNK] = event;
+  buffer->count.store(index + 1, std::memory_order_release);
+}
+
+std::string EscapeJSON(std::string_view str)
+{
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+      result += c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      result += fmt::format("\\u{:04x}", static_cast<int>(c));
+    }
+    else
+    {
+      result += c;
+    }
+  }
+  return result;
+}
+
+// Timestamps in the trace format are in microseconds.
+std::string FormatMicroseconds(u64 ns)
+{
+  return fmt::format("{}.{:03}", ns / 1000, ns % 1000);
+}
+}  // namespace
+
+namespace detail
+{
+std::atomic<bool> s_enabled = false;
+
+u64 Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void Record(const char* name, const char* category, u64 start, u64 end)
+{
+  if (!IsEnabled())
+    return;
+
+  Push({name, category, start, end - start});
+}
+}  // namespace detail
+
+void Start()
+{
+  std::lock_guard lk(s_mutex);
+  FreeUnusedBuffers();
+  s_start_time = detail::Now();
+  s_generation.fetch_add(1, std::memory_order_release);
+  detail::s_enabled.store(true, std::memory_order_relaxed);
+}
+
+bool StopAndWrite(const std::string& path)
+{
+  detail::s_enabled.store(false, std::memory_order_relaxed);
+
+  std::lock_guard lk(s_mutex);
+  File::IOFile file(path, "wb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(COMMON, "Could not open {} for writing the trace", path);
+    return false;
+  }
+
+  const u32 generation = s_generation.load(std::memory_order_relaxed);
+  std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  bool first_event = true;
+  const auto append_event = [&](std::string_view json) {
+    if (!first_event)
+      out += ",\n";
+    first_event = false;
+    out += json;
+  };
+
+  size_t num_events = 0;
+  u64 num_dropped = 0;
+  for (const auto& buffer : s_buffers)
+  {
+    if (buffer->generation.load(std::memory_order_acquire) != generation)
+      continue;
+
+    const size_t count = buffer->count.load(std::memory_order_acquire);
+    if (count == 0)
+      continue;
+
+    if (!buffer->name.empty())
+    {
+      append_event(fmt::format(
+          R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+          buffer->thread_id, EscapeJSON(buffer->name)));
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+      const Event& event = buffer->chunks[i / EVENTS_PER_CHUNK][i % EVENTS_PER_CHUNK];
+      const std::string timestamp =
+          FormatMicroseconds(std::max(event.start, s_start_time) - s_start_time);
+      if (event.duration == INSTANT_EVENT)
+      {
+        append_event(
+            fmt::format(R"({{"name":"{}","cat":"{}","ph":"i","s":"t","ts":{},"pid":1,"tid":{}}})",
+                        EscapeJSON(event.name), EscapeJSON(event.category), timestamp,
+                        buffer->thread_id));
+      }
+      else
+      {
+        append_event(fmt::format(
+            R"({{"name":"{}","cat":"{}","ph":"X","ts":{},"dur":{},"pid":1,"tid":{}}})",
+            EscapeJSON(event.name), EscapeJSON(event.category), timestamp,
+            FormatMicroseconds(event.duration), buffer->thread_id));
+      }
+
+      // Keep memory usage in check for long traces.
+      if (out.size() >= 1024 * 1024)
+      {
+        file.WriteString(out);
+        out.clear();
+      }
+    }
+
+    num_events += count;
+    num_dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  out += "\n]}\n";
+
+  FreeUnusedBuffers();
+
+  if (num_dropped != 0)
+    WARN_LOG_FMT(COMMON, "Trace buffers were full, {} events were dropped", num_dropped);
+  INFO_LOG_FMT(COMMON, "Wrote {} trace events to {}", num_events, path);
+  return file.WriteString(out);
+}
+
+void SetThreadName(std::string_view name)
+{
+  t_thread_name = name;
+  if (t_owner.buffer)
+  {
+    std::lock_guard lk(s_mutex);
+    t_owner.buffer->name = name;
+  }
+}
+
+const char* InternName(std::string_view name)
+{
+  std::lock_guard lk(s_mutex);
+  auto it = s_interned_names.find(name);
+  if (it == s_interned_names.end())
+    it = s_interned_names.emplace(name).first;
+  return it->c_str();
+}
+
+void Instant(const char* name, const char* category)
+{
+  if (!IsEnabled())
+    return;
+
+  Push({name, category, detail::Now(), INSTANT_EVENT});
+}
+}  // namespace Common::Tracer
@@ -0,0 +1,71 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+#include "Common/CommonTypes.h"
+
+// Records timestamped events from any thread into per-thread buffers, and writes them out in the
+// Chrome trace event format, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing
+// to look at what every thread was doing on a shared timeline.
+//
+// Recording is lock-free. While tracing is stopped, a ScopedEvent costs a relaxed atomic load.
+// Event names and categories are not copied, so they must be string literals or come from
+// InternName().
+namespace Common::Tracer
+{
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+u64 Now();
+void Record(const char* name, const char* category, u64 start, u64 end);
+}  // namespace detail
+
+inline bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+// Starts recording, discarding the events of any previous trace.
+void Start();
+
+// Stops recording, and writes the events recorded since Start() to the given file.
+bool StopAndWrite(const std::string& path);
+
+// Names the calling thread in traces. Called by Common::SetCurrentThreadName.
+void SetThreadName(std::string_view name);
+
+// Returns a copy of the name which stays valid until the process exits.
+const char* InternName(std::string_view name);
+
+// Records an event without duration.
+void Instant(const char* name, const char* category);
+
+// Records an event lasting from construction to destruction.
+class ScopedEvent
+{
+public:
+  ScopedEvent(const char* name, const char* category)
+      : m_name(IsEnabled() ? name : nullptr), m_category(category),
+        m_start(m_name ? detail::Now() : 0)
+  {
+  }
+  ~ScopedEvent()
+  {
+    if (m_name)
+      detail::Record(m_name, m_category, m_start, detail::Now());
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+  const char* m_name;
+  const char* m_category;
+  u64 m_start;
+};
+}  // namespace Common::Tracer
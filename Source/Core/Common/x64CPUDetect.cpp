@@ -140,6 +140,7 @@ void CPUInfo::Detect()
   // Detect family and other misc stuff.
   bool is_amd_family_17 = false;
   bool has_sse = false;
+  bool has_zmm_state = false;
   if (func_id_max >= 1)
   {
     info = cpuid(1);
@@ -188,11 +189,14 @@ void CPUInfo::Detect()
     if (((info.ecx >> 28) & 1) && ((info.ecx >> 27) & 1))
     {
       // Check that XSAVE can be used for SSE and AVX
-      if ((xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b110) == 0b110)
+      const u64 xcr0 = xgetbv(XCR_XFEATURE_ENABLED_MASK);
+      if ((xcr0 & 0b110) == 0b110)
       {
         bAVX = true;
         if ((info.ecx >> 12) & 1)
           bFMA = true;
+        // AVX-512 additionally needs the opmask, ZMM_Hi256 and Hi16_ZMM state enabled
+        has_zmm_state = (xcr0 & 0b11100000) == 0b11100000;
       }
     }
 
@@ -203,6 +207,8 @@ void CPUInfo::Detect()
         bBMI1 = true;
       if ((info.ebx >> 8) & 1)
         bBMI2 = true;
+      if (((info.ebx >> 16) & 1) && has_zmm_state)
+        bAVX512F = true;
       if ((info.ebx >> 29) & 1)
         bSHA1 = bSHA2 = true;
     }
@@ -259,6 +265,8 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX512F)
+    sum.push_back("AVX512F");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
@@ -106,6 +106,12 @@ const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE{
 const Info<int> GFX_SHADER_COMPILER_THREADS{{System::GFX, "Settings", "ShaderCompilerThreads"}, 1};
 const Info<int> GFX_SHADER_PRECOMPILER_THREADS{
     {System::GFX, "Settings", "ShaderPrecompilerThreads"}, -1};
+const Info<bool> GFX_PRECOMPILE_SHARED_PIPELINES{
+    {System::GFX, "Settings", "PrecompileSharedPipelines"}, false};
+const Info<int> GFX_SHARED_PIPELINE_PRECOMPILE_LIMIT{
+    {System::GFX, "Settings", "SharedPipelinePrecompileLimit"}, 2000};
+const Info<int> GFX_SHARED_PIPELINE_PRECOMPILE_TIME{
+    {System::GFX, "Settings", "SharedPipelinePrecompileTime"}, 30};
 const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE{
     {System::GFX, "Settings", "SaveTextureCacheToState"}, true};
 const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION{
@@ -93,6 +93,9 @@ extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
 extern const Info<int> GFX_SHADER_COMPILER_THREADS;
 extern const Info<int> GFX_SHADER_PRECOMPILER_THREADS;
+extern const Info<bool> GFX_PRECOMPILE_SHARED_PIPELINES;
+extern const Info<int> GFX_SHARED_PIPELINE_PRECOMPILE_LIMIT;
+extern const Info<int> GFX_SHARED_PIPELINE_PRECOMPILE_TIME;
 extern const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE;
 extern const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION;
 extern const Info<bool> GFX_CPU_CULL;
@@ -40,8 +40,11 @@ const Info<PowerPC::CPUCore> MAIN_CPU_CORE{{System::Main, "Core", "CPUCore"},
 const Info<bool> MAIN_JIT_FOLLOW_BRANCH{{System::Main, "Core", "JITFollowBranch"}, true};
 const Info<bool> MAIN_FASTMEM{{System::Main, "Core", "Fastmem"}, true};
 const Info<bool> MAIN_FASTMEM_ARENA{{System::Main, "Core", "FastmemArena"}, true};
+const Info<bool> MAIN_HUGE_PAGES{{System::Main, "Core", "HugePages"}, false};
 const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP{{System::Main, "Core", "LargeEntryPointsMap"}, true};
 const Info<bool> MAIN_ACCURATE_CPU_CACHE{{System::Main, "Core", "AccurateCPUCache"}, false};
+const Info<bool> MAIN_ACCELERATE_LIBRARY_FUNCTIONS{
+    {System::Main, "Core", "AccelerateLibraryFunctions"}, false};
 const Info<bool> MAIN_DSP_HLE{{System::Main, "Core", "DSPHLE"}, true};
 const Info<int> MAIN_MAX_FALLBACK{{System::Main, "Core", "MaxFallback"}, 100};
 const Info<int> MAIN_TIMING_VARIANCE{{System::Main, "Core", "TimingVariance"}, 40};
@@ -516,6 +519,9 @@ const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF{{System::Main, "Debug", "JitR
                                                    false};
 const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING{{System::Main, "Debug", "JitEnableProfiling"},
                                                  false};
+const Info<bool> MAIN_DEBUG_JIT_PROFILE_TIMING{{System::Main, "Debug", "JitProfileTiming"}, true};
+const Info<bool> MAIN_DEBUG_JIT_PROFILE_DUMP_ON_EXIT{
+    {System::Main, "Debug", "JitProfileDumpOnExit"}, false};
 
 // Main.BluetoothPassthrough
 
@@ -57,8 +57,10 @@ extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+extern const Info<bool> MAIN_HUGE_PAGES;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
+extern const Info<bool> MAIN_ACCELERATE_LIBRARY_FUNCTIONS;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_MAX_FALLBACK;
@@ -339,6 +341,8 @@ extern const Info<bool> MAIN_DEBUG_JIT_SYSTEM_REGISTERS_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_BRANCH_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_REGISTER_CACHE_OFF;
 extern const Info<bool> MAIN_DEBUG_JIT_ENABLE_PROFILING;
+extern const Info<bool> MAIN_DEBUG_JIT_PROFILE_TIMING;
+extern const Info<bool> MAIN_DEBUG_JIT_PROFILE_DUMP_ON_EXIT;
 
 // Main.BluetoothPassthrough
 
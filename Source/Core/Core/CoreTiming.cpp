@@ -15,6 +15,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/SPSCQueue.h"
+#include "Common/Tracer.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -68,7 +69,8 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
              "during Init to avoid breaking save states.",
              name);
 
-  auto info = m_event_types.emplace(name, EventType{callback, nullptr});
+  auto info =
+      m_event_types.emplace(name, EventType{callback, nullptr, Common::Tracer::InternName(name)});
   EventType* event_type = &info.first->second;
   event_type->name = &info.first->first;
   return event_type;
@@ -335,6 +337,7 @@ void CoreTimingManager::Advance()
     m_event_queue.pop_back();
 
     Throttle(evt.time);
+    Common::Tracer::ScopedEvent trace(evt.type->trace_name, "CoreTiming");
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
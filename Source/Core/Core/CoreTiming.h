@@ -52,6 +52,8 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+  // Name used for the callback's events in traces.
+  const char* trace_name;
 };
 
 struct Event
@@ -13,6 +13,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_Lib.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -28,7 +29,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 36> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -60,7 +61,22 @@ constexpr std::array<Hook, 23> os_patches{{
 
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
-    {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed} // apploader needs OSReport-like function
+    {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed}, // apploader needs OSReport-like function
+
+    // Library functions
+    {"memcpy",                       HLE_Lib::HLE_memcpy,                   HookType::Replace, HookFlag::Accelerated},
+    {"memmove",                      HLE_Lib::HLE_memmove,                  HookType::Replace, HookFlag::Accelerated},
+    {"memset",                       HLE_Lib::HLE_memset,                   HookType::Replace, HookFlag::Accelerated},
+    {"strlen",                       HLE_Lib::HLE_strlen,                   HookType::Replace, HookFlag::Accelerated},
+    {"strcmp",                       HLE_Lib::HLE_strcmp,                   HookType::Replace, HookFlag::Accelerated},
+    {"strcpy",                       HLE_Lib::HLE_strcpy,                   HookType::Replace, HookFlag::Accelerated},
+    {"DCFlushRange",                 HLE_Lib::HLE_DCFlushRange,             HookType::Replace, HookFlag::Accelerated},
+    {"DCStoreRange",                 HLE_Lib::HLE_DCStoreRange,             HookType::Replace, HookFlag::Accelerated},
+    {"ICInvalidateRange",            HLE_Lib::HLE_ICInvalidateRange,        HookType::Replace, HookFlag::Accelerated},
+    {"PSMTXIdentity",                HLE_Lib::HLE_PSMTXIdentity,            HookType::Replace, HookFlag::Accelerated},
+    {"PSMTXCopy",                    HLE_Lib::HLE_PSMTXCopy,                HookType::Replace, HookFlag::Accelerated},
+    {"PSMTXTrans",                   HLE_Lib::HLE_PSMTXTrans,               HookType::Replace, HookFlag::Accelerated},
+    {"PSMTXScale",                   HLE_Lib::HLE_PSMTXScale,               HookType::Replace, HookFlag::Accelerated},
 }};
 // clang-format on
 
@@ -234,6 +250,15 @@ TryReplaceFunctionResult TryReplaceFunction(PPCSymbolDB& ppc_symbol_db, u32 addr
 
 bool IsEnabled(HookFlag flag, PowerPC::CoreMode mode)
 {
+  // The native replacements bypass the emulated data cache, as well as memory breakpoints and
+  // watchpoints. Adding a memcheck clears the JIT cache, so this gets checked again then.
+  if (flag == HookFlag::Accelerated)
+  {
+    return Config::Get(Config::MAIN_ACCELERATE_LIBRARY_FUNCTIONS) &&
+           !Config::Get(Config::MAIN_ACCURATE_CPU_CACHE) && !Config::IsDebuggingEnabled() &&
+           !Core::System::GetInstance().GetPowerPC().GetMemChecks().HasAny();
+  }
+
   return flag != HLE::HookFlag::Debug || Config::IsDebuggingEnabled() ||
          mode == PowerPC::CoreMode::Interpreter;
 }
@@ -33,9 +33,10 @@ enum class HookType
 
 enum class HookFlag
 {
-  Generic,  // Miscellaneous function
-  Debug,    // Debug output function
-  Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  Generic,      // Miscellaneous function
+  Debug,        // Debug output function
+  Fixed,        // An arbitrary hook mapped to a fixed address instead of a symbol
+  Accelerated,  // Native replacement of a library function, for speed
 };
 
 struct Hook
@@ -0,0 +1,358 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_Lib.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace HLE_Lib
+{
+namespace
+{
+constexpr u32 CACHE_LINE_SIZE = 32;
+constexpr u32 MATRIX_SIZE = 3 * 4 * sizeof(float);
+constexpr u32 ONE = 0x3f800000;  // 1.0f
+
+std::optional<u32> TranslateAddress(Core::System& system, u32 address)
+{
+  if (!system.GetPPCState().msr.DR)
+    return address;
+  return system.GetMMU().GetTranslatedAddress(address);
+}
+
+// Returns a host pointer to the given range of guest memory if all of it is contiguous RAM, or
+// nullptr if it has to be accessed through the MMU instead.
+u8* GetRAMPointer(Core::System& system, u32 address, u32 size)
+{
+  const std::optional<u32> physical_address = TranslateAddress(system, address);
+  if (!physical_address)
+    return nullptr;
+
+  // Page table mappings don't have to be contiguous.
+  for (u64 offset = PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK); offset < size;
+       offset += PowerPC::HW_PAGE_SIZE)
+  {
+    const std::optional<u32> page = TranslateAddress(system, address + static_cast<u32>(offset));
+    if (!page || *page != *physical_address + offset)
+      return nullptr;
+  }
+
+  auto& memory = system.GetMemory();
+  const u32 segment = *physical_address >> 28;
+  const u64 offset = *physical_address & 0x0FFFFFFF;
+  if (segment == 0x0 && memory.GetRAM() && offset + size <= memory.GetRamSizeReal())
+    return memory.GetRAM() + offset;
+  if (segment == 0x1 && memory.GetEXRAM() && offset + size <= memory.GetExRamSizeReal())
+    return memory.GetEXRAM() + offset;
+  return nullptr;
+}
+
+// Byte access to guest memory which translates each page only once.
+class GuestBytes
+{
+public:
+  explicit GuestBytes(const Core::CPUThreadGuard& guard) : m_guard(guard) {}
+
+  u8 Read(u32 address)
+  {
+    const u8* const page = GetPage(address);
+    return page ? page[address & PowerPC::HW_PAGE_MASK] :
+                  PowerPC::MMU::HostRead_U8(m_guard, address);
+  }
+
+  void Write(u32 address, u8 value)
+  {
+    u8* const page = GetPage(address);
+    if (page)
+      page[address & PowerPC::HW_PAGE_MASK] = value;
+    else
+      PowerPC::MMU::HostWrite_U8(m_guard, value, address);
+  }
+
+private:
+  u8* GetPage(u32 address)
+  {
+    const u32 page_address = address & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    if (page_address != m_page_address)
+    {
+      m_page_address = page_address;
+      m_page = GetRAMPointer(m_guard.GetSystem(), page_address, PowerPC::HW_PAGE_SIZE);
+    }
+    return m_page;
+  }
+
+  const Core::CPUThreadGuard& m_guard;
+  std::optional<u32> m_page_address;
+  u8* m_page = nullptr;
+};
+
+// The replaced code would have taken time to run, so charge roughly that many cycles to keep
+// timing sensitive code working.
+void ChargeCycles(PowerPC::PowerPCState& ppc_state, u64 cycles)
+{
+  ppc_state.downcount -= static_cast<s32>(std::min<u64>(cycles, 0x7fffffff));
+}
+
+void Return(PowerPC::PowerPCState& ppc_state)
+{
+  ppc_state.npc = LR(ppc_state);
+}
+
+void Move(const Core::CPUThreadGuard& guard, u32 dest, u32 src, u32 size)
+{
+  if (size == 0 || dest == src)
+    return;
+
+  auto& system = guard.GetSystem();
+  u8* const dest_pointer = GetRAMPointer(system, dest, size);
+  const u8* const src_pointer = GetRAMPointer(system, src, size);
+  if (dest_pointer && src_pointer)
+  {
+    std::memmove(dest_pointer, src_pointer, size);
+    return;
+  }
+
+  // Copy in the direction that handles overlapping ranges.
+  GuestBytes dest_bytes(guard);
+  GuestBytes src_bytes(guard);
+  if (dest < src)
+  {
+    for (u32 i = 0; i < size; i++)
+      dest_bytes.Write(dest + i, src_bytes.Read(src + i));
+  }
+  else
+  {
+    for (u32 i = size; i > 0; i--)
+      dest_bytes.Write(dest + i - 1, src_bytes.Read(src + i - 1));
+  }
+}
+
+void WriteMatrix(const Core::CPUThreadGuard& guard, u32 address,
+                 const std::array<u32, 12>& matrix)
+{
+  u8* const pointer = GetRAMPointer(guard.GetSystem(), address, MATRIX_SIZE);
+  for (size_t i = 0; i < matrix.size(); i++)
+  {
+    if (pointer)
+    {
+      const u32 value = Common::swap32(matrix[i]);
+      std::memcpy(pointer + i * sizeof(u32), &value, sizeof(u32));
+    }
+    else
+    {
+      PowerPC::MMU::HostWrite_U32(guard, matrix[i], address + static_cast<u32>(i * sizeof(u32)));
+    }
+  }
+}
+
+// Float arguments are passed as doubles, and stored as singles by stfs.
+u32 GetSingleArgument(const PowerPC::PowerPCState& ppc_state, u32 index)
+{
+  return ConvertToSingle(ppc_state.ps[index].PS0AsU64());
+}
+
+u32 GetCacheLineCount(u32 address, u32 size)
+{
+  const u64 end = u64{address} + size;
+  const u64 first_line = address & ~(CACHE_LINE_SIZE - 1);
+  return static_cast<u32>((end - first_line + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE);
+}
+}  // namespace
+
+// The SDK's memcpy handles overlapping ranges the same way as memmove.
+void HLE_memcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 size = ppc_state.gpr[5];
+  Move(guard, ppc_state.gpr[3], ppc_state.gpr[4], size);
+  ChargeCycles(ppc_state, size / 4);
+  Return(ppc_state);
+}
+
+void HLE_memmove(const Core::CPUThreadGuard& guard)
+{
+  HLE_memcpy(guard);
+}
+
+void HLE_memset(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 dest = ppc_state.gpr[3];
+  const u8 value = static_cast<u8>(ppc_state.gpr[4]);
+  const u32 size = ppc_state.gpr[5];
+
+  if (size != 0)
+  {
+    u8* const pointer = GetRAMPointer(guard.GetSystem(), dest, size);
+    if (pointer)
+    {
+      std::memset(pointer, value, size);
+    }
+    else
+    {
+      GuestBytes bytes(guard);
+      for (u32 i = 0; i < size; i++)
+        bytes.Write(dest + i, value);
+    }
+  }
+
+  ChargeCycles(ppc_state, size / 4);
+  Return(ppc_state);
+}
+
+void HLE_strlen(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 str = ppc_state.gpr[3];
+
+  GuestBytes bytes(guard);
+  u32 length = 0;
+  while (bytes.Read(str + length) != 0)
+    length++;
+
+  ppc_state.gpr[3] = length;
+  ChargeCycles(ppc_state, length);
+  Return(ppc_state);
+}
+
+void HLE_strcmp(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 str1 = ppc_state.gpr[3];
+  const u32 str2 = ppc_state.gpr[4];
+
+  GuestBytes bytes1(guard);
+  GuestBytes bytes2(guard);
+  u32 i = 0;
+  while (true)
+  {
+    const u8 c1 = bytes1.Read(str1 + i);
+    const u8 c2 = bytes2.Read(str2 + i);
+    if (c1 != c2 || c1 == 0)
+    {
+      ppc_state.gpr[3] = static_cast<u32>(s32{c1} - s32{c2});
+      break;
+    }
+    i++;
+  }
+
+  ChargeCycles(ppc_state, i);
+  Return(ppc_state);
+}
+
+void HLE_strcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 dest = ppc_state.gpr[3];
+  const u32 src = ppc_state.gpr[4];
+
+  GuestBytes dest_bytes(guard);
+  GuestBytes src_bytes(guard);
+  u32 i = 0;
+  while (true)
+  {
+    const u8 c = src_bytes.Read(src + i);
+    dest_bytes.Write(dest + i, c);
+    if (c == 0)
+      break;
+    i++;
+  }
+
+  ChargeCycles(ppc_state, i);
+  Return(ppc_state);
+}
+
+// These replacements are never used with data cache emulation, in which case dcbf and dcbst only
+// invalidate the JIT blocks in the range.
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 address = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+
+  if (size != 0)
+  {
+    const u32 count = GetCacheLineCount(address, size);
+    system.GetJitInterface().InvalidateICacheLines(address, count);
+    ChargeCycles(ppc_state, count);
+  }
+  Return(ppc_state);
+}
+
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard)
+{
+  HLE_DCFlushRange(guard);
+}
+
+void HLE_ICInvalidateRange(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  auto& memory = system.GetMemory();
+  auto& jit_interface = system.GetJitInterface();
+  const u32 address = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+
+  if (size != 0)
+  {
+    const u32 count = GetCacheLineCount(address, size);
+    const u32 first_line = address & ~(CACHE_LINE_SIZE - 1);
+    for (u32 i = 0; i < count; i++)
+      ppc_state.iCache.Invalidate(memory, jit_interface, first_line + i * CACHE_LINE_SIZE);
+    ChargeCycles(ppc_state, count);
+  }
+  Return(ppc_state);
+}
+
+void HLE_PSMTXIdentity(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  WriteMatrix(guard, ppc_state.gpr[3], {ONE, 0, 0, 0, 0, ONE, 0, 0, 0, 0, ONE, 0});
+  ChargeCycles(ppc_state, 12);
+  Return(ppc_state);
+}
+
+void HLE_PSMTXCopy(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  Move(guard, ppc_state.gpr[4], ppc_state.gpr[3], MATRIX_SIZE);
+  ChargeCycles(ppc_state, 12);
+  Return(ppc_state);
+}
+
+void HLE_PSMTXTrans(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 x = GetSingleArgument(ppc_state, 1);
+  const u32 y = GetSingleArgument(ppc_state, 2);
+  const u32 z = GetSingleArgument(ppc_state, 3);
+  WriteMatrix(guard, ppc_state.gpr[3], {ONE, 0, 0, x, 0, ONE, 0, y, 0, 0, ONE, z});
+  ChargeCycles(ppc_state, 12);
+  Return(ppc_state);
+}
+
+void HLE_PSMTXScale(const Core::CPUThreadGuard& guard)
+{
+  auto& ppc_state = guard.GetSystem().GetPPCState();
+  const u32 x = GetSingleArgument(ppc_state, 1);
+  const u32 y = GetSingleArgument(ppc_state, 2);
+  const u32 z = GetSingleArgument(ppc_state, 3);
+  WriteMatrix(guard, ppc_state.gpr[3], {x, 0, 0, 0, 0, y, 0, 0, 0, 0, z, 0});
+  ChargeCycles(ppc_state, 12);
+  Return(ppc_state);
+}
+}  // namespace HLE_Lib
@@ -0,0 +1,32 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace Core
+{
+class CPUThreadGuard;
+}
+
+// Native replacements for hot SDK and C library routines. These skip the guest code entirely, so
+// they are only used when MAIN_ACCELERATE_LIBRARY_FUNCTIONS is enabled. They access guest memory
+// directly, which memory breakpoints and watchpoints would not see, so they are also disabled
+// while debugging is enabled or any memcheck exists.
+namespace HLE_Lib
+{
+void HLE_memcpy(const Core::CPUThreadGuard& guard);
+void HLE_memmove(const Core::CPUThreadGuard& guard);
+void HLE_memset(const Core::CPUThreadGuard& guard);
+void HLE_strlen(const Core::CPUThreadGuard& guard);
+void HLE_strcmp(const Core::CPUThreadGuard& guard);
+void HLE_strcpy(const Core::CPUThreadGuard& guard);
+
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard);
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard);
+void HLE_ICInvalidateRange(const Core::CPUThreadGuard& guard);
+
+void HLE_PSMTXIdentity(const Core::CPUThreadGuard& guard);
+void HLE_PSMTXCopy(const Core::CPUThreadGuard& guard);
+void HLE_PSMTXTrans(const Core::CPUThreadGuard& guard);
+void HLE_PSMTXScale(const Core::CPUThreadGuard& guard);
+}  // namespace HLE_Lib
@@ -20,6 +20,7 @@
 #include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/Tracer.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -345,8 +346,11 @@ void DVDThread::DVDThreadMain()
       m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+      {
+        Common::Tracer::ScopedEvent trace("Disc read", "DVD");
+        if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+          buffer.resize(0);
+      }
 
       request.realtime_done_us = Common::Timer::NowUs();
 
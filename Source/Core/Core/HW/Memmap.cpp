@@ -10,15 +10,18 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstring>
 #include <memory>
 #include <span>
+#include <thread>
 #include <tuple>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -39,8 +42,35 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/PixelEngine.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace Memory
 {
+namespace
+{
+// Page table mappings are keyed by their logical address rotated so that the TLB index comes
+// first, which makes the mappings invalidated by a tlbie a contiguous range.
+constexpr int TLB_INDEX_BITS = std::popcount(PowerPC::HW_PAGE_INDEX_MASK);
+constexpr int PAGE_TABLE_KEY_ROTATION = 32 - PowerPC::HW_PAGE_INDEX_SHIFT - TLB_INDEX_BITS;
+
+u32 GetPageTableMappingKey(u32 logical_address)
+{
+  return std::rotl(logical_address, PAGE_TABLE_KEY_ROTATION);
+}
+
+// The granularity at which RAM snapshots are copied. Must be a multiple of the host page size.
+constexpr u32 RAM_SNAPSHOT_CHUNK_SIZE = 0x10000;
+
+enum RAMSnapshotChunkState : u8
+{
+  CHUNK_PENDING,
+  CHUNK_COPYING,
+  CHUNK_COPIED,
+};
+}  // namespace
+
 MemoryManager::MemoryManager(Core::System& system) : m_system(system)
 {
 }
@@ -121,6 +151,8 @@ void MemoryManager::Init()
     region.active = true;
     mem_size += region.size;
   }
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    m_arena.EnableHugePages();
   m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
 
   m_physical_page_mappings.fill(nullptr);
@@ -228,6 +260,14 @@ bool MemoryManager::InitFastmemArena()
     }
   }
 
+#ifdef _WIN32
+  // Views have to be aligned to the 64 KiB allocation granularity.
+  m_page_table_mappings_supported = false;
+#else
+  m_page_table_mappings_supported =
+      sysconf(_SC_PAGESIZE) == static_cast<long>(PowerPC::HW_PAGE_SIZE);
+#endif
+
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
   return true;
@@ -235,6 +275,10 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // A RAM snapshot only knows about the views which existed when it was started.
+  FinishRAMSnapshot();
+  RemoveAllPageTableMappings();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -243,12 +287,22 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 
   m_logical_page_mappings.fill(nullptr);
 
+  // BAT pages which are contiguous both logically and physically are mapped together. This saves
+  // a lot of mapping calls, and lets the host use huge pages for the mappings.
+  struct PendingMapping
+  {
+    u32 physical_address;
+    u32 position;
+    u32 logical_address;
+    u32 size;
+  };
+  std::vector<PendingMapping> pending_mappings;
+
   for (u32 i = 0; i < dbat_table.size(); ++i)
   {
     if (dbat_table[i] & PowerPC::BAT_PHYSICAL_BIT)
     {
       u32 logical_address = i << PowerPC::BAT_INDEX_SHIFT;
-      // TODO: Merge adjacent mappings to make this faster.
       u32 logical_size = PowerPC::BAT_PAGE_SIZE;
       u32 translated_address = dbat_table[i] & PowerPC::BAT_RESULT_MASK;
       for (const auto& physical_region : m_physical_regions)
@@ -266,20 +320,23 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 
           if (m_is_fastmem_arena_initialized)
           {
-            u32 position = physical_region.shm_position + intersection_start - mapping_address;
-            u8* base = m_logical_base + logical_address + intersection_start - translated_address;
-            u32 mapped_size = intersection_end - intersection_start;
-
-            void* mapped_pointer = m_arena.MapInMemoryRegion(position, mapped_size, base);
-            if (!mapped_pointer)
+            const PendingMapping mapping{
+                intersection_start,
+                physical_region.shm_position + intersection_start - mapping_address,
+                logical_address + intersection_start - translated_address,
+                intersection_end - intersection_start};
+
+            PendingMapping* previous =
+                pending_mappings.empty() ? nullptr : &pending_mappings.back();
+            if (previous && previous->logical_address + previous->size == mapping.logical_address &&
+                previous->position + previous->size == mapping.position)
             {
-              PanicAlertFmt(
-                  "Memory::UpdateLogicalMemory(): Failed to map memory region at 0x{:08X} "
-                  "(size 0x{:08X}) into logical fastmem region at 0x{:08X}.",
-                  intersection_start, mapped_size, logical_address);
-              exit(0);
+              previous->size += mapping.size;
+            }
+            else
+            {
+              pending_mappings.push_back(mapping);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
           }
 
           m_logical_page_mappings[i] =
@@ -288,6 +345,94 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
       }
     }
   }
+
+  for (const PendingMapping& mapping : pending_mappings)
+  {
+    u8* base = m_logical_base + mapping.logical_address;
+    void* mapped_pointer = m_arena.MapInMemoryRegion(mapping.position, mapping.size, base);
+    if (!mapped_pointer)
+    {
+      PanicAlertFmt("Memory::UpdateLogicalMemory(): Failed to map memory region at 0x{:08X} "
+                    "(size 0x{:08X}) into logical fastmem region at 0x{:08X}.",
+                    mapping.physical_address, mapping.size, mapping.logical_address);
+      exit(0);
+    }
+    m_logical_mapped_entries.push_back({mapped_pointer, mapping.size, mapping.position});
+  }
+}
+
+bool MemoryManager::AddPageTableMapping(u32 logical_address, u32 translated_address)
+{
+  if (!m_is_fastmem_arena_initialized || !m_page_table_mappings_supported)
+    return false;
+
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active || translated_address < region.physical_address ||
+        translated_address - region.physical_address >= region.size)
+    {
+      continue;
+    }
+
+    FinishRAMSnapshot();
+
+    const u32 position = region.shm_position + translated_address - region.physical_address;
+    u8* base = m_logical_base + logical_address;
+    void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+    if (!mapped_pointer)
+      return false;
+
+    m_page_table_mapped_entries.insert_or_assign(
+        GetPageTableMappingKey(logical_address),
+        LogicalMemoryView{mapped_pointer, static_cast<u32>(PowerPC::HW_PAGE_SIZE), position});
+    return true;
+  }
+
+  return false;
+}
+
+void MemoryManager::RemovePageTableMappings(std::map<u32, LogicalMemoryView>::iterator begin,
+                                            std::map<u32, LogicalMemoryView>::iterator end)
+{
+  if (begin != end)
+    FinishRAMSnapshot();
+
+  for (auto it = begin; it != end; ++it)
+    m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, it->second.mapped_size);
+  m_page_table_mapped_entries.erase(begin, end);
+}
+
+void MemoryManager::RemovePageTableMappings(u32 tlb_index)
+{
+  constexpr int key_shift = 32 - TLB_INDEX_BITS;
+  const auto begin = m_page_table_mapped_entries.lower_bound(tlb_index << key_shift);
+  const auto end = tlb_index == PowerPC::HW_PAGE_INDEX_MASK ?
+                       m_page_table_mapped_entries.end() :
+                       m_page_table_mapped_entries.lower_bound((tlb_index + 1) << key_shift);
+  RemovePageTableMappings(begin, end);
+}
+
+void MemoryManager::RemovePageTableMappingsInSegment(u32 segment)
+{
+  for (auto it = m_page_table_mapped_entries.begin(); it != m_page_table_mapped_entries.end();)
+  {
+    const u32 logical_address = std::rotr(it->first, PAGE_TABLE_KEY_ROTATION);
+    if (logical_address >> 28 == segment)
+    {
+      FinishRAMSnapshot();
+      m_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, it->second.mapped_size);
+      it = m_page_table_mapped_entries.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void MemoryManager::RemoveAllPageTableMappings()
+{
+  RemovePageTableMappings(m_page_table_mapped_entries.begin(), m_page_table_mapped_entries.end());
 }
 
 void MemoryManager::DoState(PointerWrap& p)
@@ -328,19 +473,256 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
+  // Loading overwrites all of RAM, so copy what's left of a snapshot in one go rather than in
+  // chunks as the writes fault.
+  if (p.IsReadMode())
+    FinishRAMSnapshot();
+
+  const bool snapshot = p.IsWriteMode() && m_ram_snapshot_requested && m_ram_snapshots_available;
+  u8* ram_snapshot = nullptr;
+  u8* exram_snapshot = nullptr;
+
+  if (snapshot)
+    ram_snapshot = p.ReserveBytes(current_ram_size);
+  else
+    p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
     p.DoArray(m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+  {
+    if (snapshot)
+      exram_snapshot = p.ReserveBytes(current_exram_size);
+    else
+      p.DoArray(m_exram, current_exram_size);
+  }
   p.DoMarker("Memory EXRAM");
+
+  if (snapshot && p.IsWriteMode())
+    BeginRAMSnapshot(ram_snapshot, exram_snapshot);
+}
+
+void MemoryManager::SetRAMSnapshotsAvailable(bool available)
+{
+#if defined(__APPLE__) && defined(_M_ARM_64)
+  // WriteProtectMemory can't change the protection of memory on this platform.
+  available = false;
+#endif
+
+  if (!available)
+    FinishRAMSnapshot();
+  m_ram_snapshots_available = available;
+}
+
+void MemoryManager::BeginRAMSnapshot(u8* ram_destination, u8* exram_destination)
+{
+  FinishRAMSnapshot();
+
+  u32 chunk_count = 0;
+  m_ram_snapshot_region_count = 0;
+  const auto add_region = [&](const PhysicalMemoryRegion& region, u8* destination) {
+    m_ram_snapshot_regions[m_ram_snapshot_region_count++] = {
+        *region.out_pointer, destination, region.shm_position, region.size, chunk_count};
+    chunk_count += region.size / RAM_SNAPSHOT_CHUNK_SIZE;
+  };
+  add_region(m_physical_regions[0], ram_destination);
+  if (exram_destination)
+    add_region(m_physical_regions[3], exram_destination);
+
+  if (chunk_count != m_ram_snapshot_chunk_count)
+  {
+    m_ram_snapshot_chunks = std::make_unique<std::atomic<u8>[]>(chunk_count);
+    m_ram_snapshot_chunk_count = chunk_count;
+  }
+  for (u32 i = 0; i < chunk_count; ++i)
+    m_ram_snapshot_chunks[i].store(CHUNK_PENDING, std::memory_order_relaxed);
+
+  // Writes can go through any view of the memory, so all of them have to be protected.
+  m_ram_snapshot_views.clear();
+  for (const PhysicalMemoryRegion* region : {&m_physical_regions[0], &m_physical_regions[3]})
+  {
+    if (!region->active)
+      continue;
+
+    AddRAMSnapshotView(*region->out_pointer, region->size, region->shm_position);
+    if (m_is_fastmem_arena_initialized)
+    {
+      AddRAMSnapshotView(m_physical_base + region->physical_address, region->size,
+                         region->shm_position);
+    }
+  }
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+    AddRAMSnapshotView(static_cast<u8*>(view.mapped_pointer), view.mapped_size, view.shm_position);
+  for (const auto& [key, view] : m_page_table_mapped_entries)
+    AddRAMSnapshotView(static_cast<u8*>(view.mapped_pointer), view.mapped_size, view.shm_position);
+
+  // Other threads may write to RAM while the views are being protected, so the fault handler has
+  // to be ready before the first one is.
+  m_ram_snapshot_active.store(true);
+  for (const LogicalMemoryView& view : m_ram_snapshot_views)
+    Common::WriteProtectMemory(view.mapped_pointer, view.mapped_size);
+}
+
+void MemoryManager::AddRAMSnapshotView(u8* pointer, u32 size, u32 shm_position)
+{
+  for (u32 i = 0; i < m_ram_snapshot_region_count; ++i)
+  {
+    const RAMSnapshotRegion& region = m_ram_snapshot_regions[i];
+    const u32 start = std::max(shm_position, region.shm_position);
+    const u32 end = std::min(shm_position + size, region.shm_position + region.size);
+    if (start < end)
+      m_ram_snapshot_views.push_back({pointer + (start - shm_position), end - start, start});
+  }
+}
+
+void MemoryManager::FinishRAMSnapshot()
+{
+  if (!m_ram_snapshot_active.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard lk(m_ram_snapshot_mutex);
+  if (!m_ram_snapshot_active.load())
+    return;
+
+  for (u32 i = 0; i < m_ram_snapshot_region_count; ++i)
+  {
+    const RAMSnapshotRegion& region = m_ram_snapshot_regions[i];
+    for (u32 chunk = 0; chunk < region.size / RAM_SNAPSHOT_CHUNK_SIZE; ++chunk)
+      CopyRAMSnapshotChunk(region, chunk, false);
+  }
+  for (const LogicalMemoryView& view : m_ram_snapshot_views)
+    Common::UnWriteProtectMemory(view.mapped_pointer, view.mapped_size);
+
+  m_ram_snapshot_active.store(false);
+
+  // Fault handlers which saw the snapshot as active may still be looking at the views.
+  while (m_ram_snapshot_faults_in_flight.load() != 0)
+    std::this_thread::yield();
+}
+
+bool MemoryManager::HandleRAMSnapshotFault(uintptr_t fault_address)
+{
+  bool handled = false;
+
+  m_ram_snapshot_faults_in_flight.fetch_add(1);
+  if (m_ram_snapshot_active.load())
+  {
+    for (const LogicalMemoryView& view : m_ram_snapshot_views)
+    {
+      const uintptr_t offset = fault_address - reinterpret_cast<uintptr_t>(view.mapped_pointer);
+      if (offset >= view.mapped_size)
+        continue;
+
+      const u32 shm_position = view.shm_position + static_cast<u32>(offset);
+      for (u32 i = 0; i < m_ram_snapshot_region_count; ++i)
+      {
+        const RAMSnapshotRegion& region = m_ram_snapshot_regions[i];
+        const u32 region_offset = shm_position - region.shm_position;
+        if (region_offset < region.size)
+          CopyRAMSnapshotChunk(region, region_offset / RAM_SNAPSHOT_CHUNK_SIZE, true);
+      }
+      handled = true;
+      break;
+    }
+  }
+  else
+  {
+    // The write may have faulted right before another thread finished the snapshot, in which case
+    // the memory is writable again by now.
+    handled = IsInStableRAMView(fault_address);
+  }
+  m_ram_snapshot_faults_in_flight.fetch_sub(1);
+
+  return handled;
+}
+
+void MemoryManager::CopyRAMSnapshotChunk(const RAMSnapshotRegion& region, u32 chunk,
+                                         bool unprotect) const
+{
+  std::atomic<u8>& state = m_ram_snapshot_chunks[region.first_chunk + chunk];
+  const u32 offset = chunk * RAM_SNAPSHOT_CHUNK_SIZE;
+
+  u8 expected = CHUNK_PENDING;
+  if (state.compare_exchange_strong(expected, CHUNK_COPYING, std::memory_order_acquire))
+  {
+    std::memcpy(region.destination + offset, region.source + offset, RAM_SNAPSHOT_CHUNK_SIZE);
+    state.store(CHUNK_COPIED, std::memory_order_release);
+  }
+  else
+  {
+    // Another thread is copying the chunk. Nothing can write to it until that's done.
+    while (state.load(std::memory_order_acquire) != CHUNK_COPIED)
+      std::this_thread::yield();
+  }
+
+  if (!unprotect)
+    return;
+
+  const u32 start = region.shm_position + offset;
+  const u32 end = start + RAM_SNAPSHOT_CHUNK_SIZE;
+  for (const LogicalMemoryView& view : m_ram_snapshot_views)
+  {
+    const u32 view_start = std::max(start, view.shm_position);
+    const u32 view_end = std::min(end, view.shm_position + view.mapped_size);
+    if (view_start < view_end)
+    {
+      Common::UnWriteProtectMemory(
+          static_cast<u8*>(view.mapped_pointer) + (view_start - view.shm_position),
+          view_end - view_start);
+    }
+  }
+}
+
+void MemoryManager::CopyRAMSnapshotRange(const u8* pointer, size_t size) const
+{
+  m_ram_snapshot_faults_in_flight.fetch_add(1);
+  if (m_ram_snapshot_active.load())
+  {
+    for (u32 i = 0; i < m_ram_snapshot_region_count; ++i)
+    {
+      const RAMSnapshotRegion& region = m_ram_snapshot_regions[i];
+      const uintptr_t offset = static_cast<uintptr_t>(pointer - region.source);
+      if (offset >= region.size)
+        continue;
+
+      const u32 first_chunk = static_cast<u32>(offset / RAM_SNAPSHOT_CHUNK_SIZE);
+      const u32 last_chunk = static_cast<u32>(
+          std::min<uintptr_t>(offset + size, region.size) - 1) / RAM_SNAPSHOT_CHUNK_SIZE;
+      for (u32 chunk = first_chunk; chunk <= last_chunk; ++chunk)
+        CopyRAMSnapshotChunk(region, chunk, true);
+      break;
+    }
+  }
+  m_ram_snapshot_faults_in_flight.fetch_sub(1);
+}
+
+bool MemoryManager::IsInStableRAMView(uintptr_t address) const
+{
+  // These views stay mapped for as long as the memory exists, unlike the logical ones.
+  for (const PhysicalMemoryRegion* region : {&m_physical_regions[0], &m_physical_regions[3]})
+  {
+    if (!region->active)
+      continue;
+
+    if (address - reinterpret_cast<uintptr_t>(*region->out_pointer) < region->size)
+      return true;
+
+    if (m_is_fastmem_arena_initialized &&
+        address - reinterpret_cast<uintptr_t>(m_physical_base + region->physical_address) <
+            region->size)
+    {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 void MemoryManager::Shutdown()
 {
+  FinishRAMSnapshot();
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -362,6 +744,8 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  FinishRAMSnapshot();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -376,6 +760,7 @@ void MemoryManager::ShutdownFastmemArena()
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
   }
   m_logical_mapped_entries.clear();
+  RemoveAllPageTableMappings();
 
   m_arena.ReleaseMemoryRegion();
 
@@ -417,6 +802,11 @@ u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
     return nullptr;
   }
 
+  // The pointer may be handed to the OS, which reports writes to write-protected memory as errors
+  // instead of raising faults that HandleRAMSnapshotFault could deal with.
+  if (size != 0 && m_ram_snapshot_active.load(std::memory_order_relaxed))
+    CopyRAMSnapshotRange(span.data(), size);
+
   return span.data();
 }
 
@@ -4,7 +4,10 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 #include <vector>
@@ -54,6 +57,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 shm_position;
 };
 
 class MemoryManager
@@ -101,8 +105,30 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Pages translated through the guest page table are mapped into the logical fastmem view one
+  // at a time, when the JIT faults on them. They have to be removed again whenever the
+  // translation may have changed.
+  bool AddPageTableMapping(u32 logical_address, u32 translated_address);
+  // Removes the mappings of all pages in the given TLB congruence class, like tlbie.
+  void RemovePageTableMappings(u32 tlb_index);
+  void RemovePageTableMappingsInSegment(u32 segment);
+  void RemoveAllPageTableMappings();
+
   void Clear();
 
+  // Copy-on-write snapshots of MEM1 and MEM2, so that savestates can be written without pausing
+  // emulation for the copy. When requested, DoState in write mode only reserves the space for
+  // these in the state and write-protects them, and the pages are copied into the reserved space
+  // when they're about to be written to or when FinishRAMSnapshot is called, whichever comes
+  // first. The state must not be used before calling FinishRAMSnapshot.
+  //
+  // Snapshots rely on the fault handler installed by the CPU thread, so they're only available
+  // while it's installed and catches faults from every thread.
+  void SetRAMSnapshotsAvailable(bool available);
+  void SetRAMSnapshotRequested(bool requested) { m_ram_snapshot_requested = requested; }
+  void FinishRAMSnapshot();
+  bool HandleRAMSnapshotFault(uintptr_t fault_address);
+
   // Routines to access physically addressed memory, designed for use by
   // emulated hardware outside the CPU. Use "Device_" prefix.
   std::string GetString(u32 em_address, size_t size = 0);
@@ -195,6 +221,8 @@ private:
   u32 m_exram_mask = 0;
 
   bool m_is_fastmem_arena_initialized = false;
+  // Host pages have to be as small as guest pages for page table mappings.
+  bool m_page_table_mappings_supported = false;
 
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
@@ -232,7 +260,8 @@ private:
   //
   // The 4GB starting at m_logical_base represents access from the CPU
   // with address translation turned on.  This mapping is computed based
-  // on the BAT registers.
+  // on the BAT registers, plus the pages of the page table that have been
+  // accessed since the last relevant TLB invalidation.
   //
   // Each of these 4GB regions is surrounded by 2GB of empty space so overflows
   // in address computation in the JIT don't access unrelated memory.
@@ -248,12 +277,42 @@ private:
   std::array<PhysicalMemoryRegion, 4> m_physical_regions{};
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
+  // Keyed by GetPageTableMappingKey(logical address).
+  std::map<u32, LogicalMemoryView> m_page_table_mapped_entries;
 
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  struct RAMSnapshotRegion
+  {
+    const u8* source;
+    u8* destination;
+    u32 shm_position;
+    u32 size;
+    u32 first_chunk;
+  };
+
+  bool m_ram_snapshots_available = false;
+  bool m_ram_snapshot_requested = false;
+  std::atomic<bool> m_ram_snapshot_active = false;
+  mutable std::atomic<u32> m_ram_snapshot_faults_in_flight = 0;
+  std::mutex m_ram_snapshot_mutex;
+  std::array<RAMSnapshotRegion, 2> m_ram_snapshot_regions{};
+  u32 m_ram_snapshot_region_count = 0;
+  // Every view of the snapshotted memory, clipped to the snapshot regions.
+  std::vector<LogicalMemoryView> m_ram_snapshot_views;
+  std::unique_ptr<std::atomic<u8>[]> m_ram_snapshot_chunks;
+  u32 m_ram_snapshot_chunk_count = 0;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void BeginRAMSnapshot(u8* ram_destination, u8* exram_destination);
+  void AddRAMSnapshotView(u8* pointer, u32 size, u32 shm_position);
+  void CopyRAMSnapshotChunk(const RAMSnapshotRegion& region, u32 chunk, bool unprotect) const;
+  void CopyRAMSnapshotRange(const u8* pointer, size_t size) const;
+  bool IsInStableRAMView(uintptr_t address) const;
+  void RemovePageTableMappings(std::map<u32, LogicalMemoryView>::iterator begin,
+                               std::map<u32, LogicalMemoryView>::iterator end);
 };
 }  // namespace Memory
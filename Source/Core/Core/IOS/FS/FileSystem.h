@@ -281,6 +281,9 @@ public:
   virtual Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) = 0;
 
   virtual void SetNandRedirects(std::vector<NandRedirect> nand_redirects) = 0;
+
+  /// Called periodically during emulation to write out any deferred changes that are due.
+  virtual void Update() = 0;
 };
 
 template <typename T>
@@ -4,6 +4,7 @@
 #include "Core/IOS/FS/HostBackend/FS.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <optional>
 #include <string_view>
@@ -30,6 +31,9 @@ namespace IOS::HLE::FS
 {
 constexpr u32 BUFFER_CHUNK_SIZE = 65536;
 
+// Changes to the FST that happen within this long of it being written are batched together.
+constexpr auto FST_SAVE_INTERVAL = std::chrono::seconds(1);
+
 HostFileSystem::HostFilename HostFileSystem::BuildFilename(const std::string& wii_path) const
 {
   for (const auto& redirect : m_nand_redirects)
@@ -91,6 +95,13 @@ auto GetNamePredicate(const std::string& name)
   return [&name](const auto& entry) { return entry.name == name; };
 }
 
+// Whether path is inside directory (at any depth).
+bool IsInDirectory(std::string_view path, std::string_view directory)
+{
+  return path.size() > directory.size() && path.starts_with(directory) &&
+         (directory.ends_with('/') || path[directory.size()] == '/');
+}
+
 // Convert the host directory entries into ones that can be exposed to the emulated system.
 static u64 FixupDirectoryEntries(File::FSTEntry* dir, bool is_root)
 {
@@ -155,7 +166,10 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   LoadFst();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  FlushFst();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -210,6 +224,9 @@ void HostFileSystem::LoadFst()
 
 void HostFileSystem::SaveFst()
 {
+  m_fst_dirty = false;
+  m_fst_save_time = std::chrono::steady_clock::now();
+
   std::vector<SerializedFstEntry> to_write;
   auto collect_entries = [&to_write](const auto& collect, const FstEntry& entry) -> void {
     SerializedFstEntry& serialized = to_write.emplace_back();
@@ -236,6 +253,28 @@ void HostFileSystem::SaveFst()
     PanicAlertFmt("IOS_FS: Failed to rename temporary FST file");
 }
 
+void HostFileSystem::FstChanged()
+{
+  // The FST only holds metadata, and files which are missing from it get default metadata, so
+  // losing the changes from the last FST_SAVE_INTERVAL in a crash is an acceptable price for not
+  // rewriting the whole file after every one of the tiny changes that games tend to make in bulk.
+  // Changes which are not followed by another one get written out by Update().
+  m_fst_dirty = true;
+  Update();
+}
+
+void HostFileSystem::FlushFst()
+{
+  if (m_fst_dirty)
+    SaveFst();
+}
+
+void HostFileSystem::Update()
+{
+  if (m_fst_dirty && std::chrono::steady_clock::now() - m_fst_save_time >= FST_SAVE_INTERVAL)
+    SaveFst();
+}
+
 HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string& path)
 {
   if (path == "/")
@@ -373,6 +412,10 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // The FST is part of the NAND contents which may be saved below, and loading may change them.
+  FlushFst();
+  m_directory_stats_cache.clear();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -453,6 +496,7 @@ ResultCode HostFileSystem::Format(Uid uid)
     return ResultCode::UnknownError;
   ResetFst();
   SaveFst();
+  m_directory_stats_cache.clear();
   // Reset and close all handles.
   m_handles = {};
   return ResultCode::Success;
@@ -497,7 +541,8 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   child->data.uid = uid;
   child->data.gid = gid;
   child->data.attribute = attr;
-  SaveFst();
+  FstChanged();
+  UpdateDirectoryStats(path, is_file, 1, 0);
   return ResultCode::Success;
 }
 
@@ -556,7 +601,8 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
     parent->children.erase(it);
-  SaveFst();
+  FstChanged();
+  InvalidateDirectoryStats(path);
 
   return ResultCode::Success;
 }
@@ -600,6 +646,9 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const std::string& host_old_path = host_old_info.host_path;
   const std::string& host_new_path = host_new_info.host_path;
 
+  InvalidateDirectoryStats(old_path);
+  InvalidateDirectoryStats(new_path);
+
   // If there is already something of the same type at the new path, delete it.
   if (File::Exists(host_new_path))
   {
@@ -652,7 +701,7 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     old_parent->children.erase(it);
   }
 
-  SaveFst();
+  FstChanged();
 
   return ResultCode::Success;
 }
@@ -736,7 +785,7 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid uid, Gid gid, const std::string
     return ResultCode::NotFound;
 
   Metadata metadata = entry->data;
-  metadata.size = File::GetSize(BuildFilename(path).host_path);
+  metadata.size = GetHostFileSize(BuildFilename(path).host_path);
   return metadata;
 }
 
@@ -755,7 +804,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
   if (caller_uid != 0 && uid != entry->data.uid)
     return ResultCode::AccessDenied;
 
-  const bool is_empty = File::GetSize(BuildFilename(path).host_path) == 0;
+  const bool is_empty = GetHostFileSize(BuildFilename(path).host_path) == 0;
   if (entry->data.uid != uid && entry->data.is_file && !is_empty)
     return ResultCode::FileNotEmpty;
 
@@ -766,7 +815,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
     entry->data.uid = uid;
     entry->data.attribute = attr;
     entry->data.modes = modes;
-    SaveFst();
+    FstChanged();
   }
 
   return ResultCode::Success;
@@ -821,6 +870,10 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   if (!IsValidPath(wii_path))
     return ResultCode::Invalid;
 
+  const auto cached_stats = m_directory_stats_cache.find(wii_path);
+  if (cached_stats != m_directory_stats_cache.end())
+    return cached_stats->second;
+
   ExtendedDirectoryStats stats{};
   std::string path(BuildFilename(wii_path).host_path);
   File::FileInfo info(path);
@@ -830,12 +883,16 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   }
   if (info.IsDirectory())
   {
+    // Make the sizes of the files that are open up to date.
+    FlushHostFiles();
+
     File::FSTEntry parent_dir = File::ScanDirectoryTree(path, true);
     FixupDirectoryEntries(&parent_dir, wii_path == "/");
 
     // add one for the folder itself
     stats.used_inodes = 1 + parent_dir.size;
     stats.used_clusters = ComputeUsedClusters(parent_dir);
+    m_directory_stats_cache.emplace(wii_path, stats);
   }
   else
   {
@@ -844,8 +901,43 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   return stats;
 }
 
+void HostFileSystem::UpdateDirectoryStats(const std::string& path, bool is_file, u64 added_inodes,
+                                          u64 added_clusters)
+{
+  if (m_directory_stats_cache.empty())
+    return;
+
+  const std::string host_path = BuildFilename(path).host_path;
+  const bool is_in_root = SplitPathAndBasename(path).parent == "/";
+  for (auto& [directory, stats] : m_directory_stats_cache)
+  {
+    if (!IsInDirectory(path, directory))
+      continue;
+
+    // The stats only cover what's in the directory's own host directory, which excludes redirects.
+    if (!IsInDirectory(host_path, BuildFilename(directory).host_path))
+      continue;
+
+    // Files in the root are hidden from the emulated system (see FixupDirectoryEntries).
+    if (directory == "/" && is_in_root && is_file)
+      continue;
+
+    stats.used_inodes += added_inodes;
+    stats.used_clusters += added_clusters;
+  }
+}
+
+void HostFileSystem::InvalidateDirectoryStats(const std::string& path)
+{
+  std::erase_if(m_directory_stats_cache, [&path](const auto& entry) {
+    const std::string& directory = entry.first;
+    return directory == path || IsInDirectory(path, directory) || IsInDirectory(directory, path);
+  });
+}
+
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  m_directory_stats_cache.clear();
 }
 }  // namespace IOS::HLE::FS
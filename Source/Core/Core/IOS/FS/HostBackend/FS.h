@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -59,6 +62,8 @@ public:
 
   void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
 
+  void Update() override;
+
 private:
   void DoStateWriteOrMeasure(PointerWrap& p, std::string start_directory_path);
   void DoStateRead(PointerWrap& p, std::string start_directory_path);
@@ -76,12 +81,32 @@ private:
     std::vector<FstEntry> children;
   };
 
+  /// A host file, shared by all handles that were opened for it.
+  ///
+  /// Seeking flushes the stdio buffer, so the position of the file is tracked to skip the seek
+  /// for accesses that continue where the previous one left off. That way, the many small reads
+  /// and writes which games tend to do are served from and coalesced in a large buffer.
+  /// Writes are flushed to the host no later than when the handle is closed.
+  struct HostFile
+  {
+    /// Positions the file for a read or write at the given offset.
+    void PrepareAccess(u64 offset, bool write);
+
+    std::unique_ptr<char[]> buffer;
+    File::IOFile file;
+    /// The position of the host file, or nullopt if it is unknown.
+    std::optional<u64> position;
+    /// Whether the last access was a write. Switching between reading and writing requires a seek.
+    bool writing = false;
+    u64 size = 0;
+  };
+
   struct Handle
   {
     bool opened = false;
     Mode mode = Mode::None;
     std::string wii_path;
-    std::shared_ptr<File::IOFile> host_file;
+    std::shared_ptr<HostFile> host_file;
     u32 file_offset = 0;
   };
   Handle* AssignFreeHandle();
@@ -94,7 +119,10 @@ private:
     bool is_redirect;
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
-  std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  std::shared_ptr<HostFile> OpenHostFile(const std::string& host_path);
+  /// Returns the size of a host file, taking into account writes which are still buffered.
+  u64 GetHostFileSize(const std::string& host_path) const;
+  void FlushHostFiles();
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
@@ -105,6 +133,11 @@ private:
   void ResetFst();
   void LoadFst();
   void SaveFst();
+  /// Called after the FST has changed. Writing it out is deferred by up to FST_SAVE_INTERVAL so
+  /// that bursts of changes only result in a single write.
+  void FstChanged();
+  /// Writes the FST if it has changed since it was last written.
+  void FlushFst();
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -119,12 +152,24 @@ private:
   /// and we do not want FS to break if the user adds or removes files in their
   /// filesystem root manually.
   FstEntry m_root_entry{};
+  bool m_fst_dirty = false;
+  std::chrono::steady_clock::time_point m_fst_save_time{};
   std::string m_root_path;
-  std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
+  std::unordered_map<std::string, std::weak_ptr<HostFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
 
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
+
+  /// Adjusts the cached stats of the directories containing path after it was created or grew.
+  void UpdateDirectoryStats(const std::string& path, bool is_file, u64 added_inodes,
+                            u64 added_clusters);
+  /// Drops the cached stats for path and for everything that is above or below it.
+  void InvalidateDirectoryStats(const std::string& path);
+
+  /// Results of GetExtendedDirectoryStats by Wii path. Walking the host directories is slow, so
+  /// the cached stats are kept up to date as far as changes made through this class go.
+  std::map<std::string, ExtendedDirectoryStats> m_directory_stats_cache;
 };
 
 }  // namespace IOS::HLE::FS
@@ -4,8 +4,10 @@
 #include "Core/IOS/FS/HostBackend/FS.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <memory>
 
+#include "Common/Align.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
@@ -13,8 +15,22 @@
 
 namespace IOS::HLE::FS
 {
+constexpr size_t HOST_FILE_BUFFER_SIZE = 0x10000;
+
+void HostFileSystem::HostFile::PrepareAccess(u64 offset, bool write)
+{
+  if (position == offset && writing == write)
+    return;
+
+  if (file.Seek(offset, File::SeekOrigin::Begin))
+    position = offset;
+  else
+    position.reset();
+  writing = write;
+}
+
 // This isn't theadsafe, but it's only called from the CPU thread.
-std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
+std::shared_ptr<HostFileSystem::HostFile> HostFileSystem::OpenHostFile(const std::string& host_path)
 {
   // On the wii, all file operations are strongly ordered.
   // If a game opens the same file twice (or 8 times, looking at you PokePark Wii)
@@ -60,16 +76,21 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   }
 
   // This code will be called when all references to the shared pointer below have been removed.
-  auto deleter = [this, host_path](File::IOFile* ptr) {
+  auto deleter = [this, host_path](HostFile* ptr) {
     delete ptr;                     // IOFile's deconstructor closes the file.
     m_open_files.erase(host_path);  // erase the weak pointer from the list of open files.
   };
 
   // Use the custom deleter from above.
-  std::shared_ptr<File::IOFile> file_ptr(new File::IOFile(std::move(file)), deleter);
+  std::shared_ptr<HostFile> file_ptr(new HostFile(), deleter);
+  file_ptr->buffer = std::make_unique<char[]>(HOST_FILE_BUFFER_SIZE);
+  std::setvbuf(file.GetHandle(), file_ptr->buffer.get(), _IOFBF, HOST_FILE_BUFFER_SIZE);
+  file_ptr->size = file.GetSize();
+  file_ptr->position = 0;
+  file_ptr->file = std::move(file);
 
   // Store a weak pointer to our newly opened file in the cache.
-  m_open_files[host_path] = std::weak_ptr<File::IOFile>(file_ptr);
+  m_open_files[host_path] = std::weak_ptr<HostFile>(file_ptr);
 
   return file_ptr;
 }
@@ -112,6 +133,9 @@ ResultCode HostFileSystem::Close(Fd fd)
   if (!handle)
     return ResultCode::Invalid;
 
+  // IOS has committed the writes to the NAND by the time a file is closed.
+  handle->host_file->file.Flush();
+
   // Let go of our pointer to the file, it will automatically close if we are the last handle
   // accessing it.
   *handle = Handle{};
@@ -121,52 +145,72 @@ ResultCode HostFileSystem::Close(Fd fd)
 Result<u32> HostFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   if ((u8(handle->mode) & u8(Mode::Read)) == 0)
     return ResultCode::AccessDenied;
 
-  const u32 file_size = static_cast<u32>(handle->host_file->GetSize());
+  HostFile& host_file = *handle->host_file;
+  const u32 file_size = static_cast<u32>(host_file.size);
   // IOS has this check in the read request handler.
   if (count + handle->file_offset > file_size)
     count = file_size - handle->file_offset;
 
   // File might be opened twice, need to seek before we read
-  handle->host_file->Seek(handle->file_offset, File::SeekOrigin::Begin);
-  const u32 actually_read = static_cast<u32>(fread(ptr, 1, count, handle->host_file->GetHandle()));
+  host_file.PrepareAccess(handle->file_offset, false);
+  const u32 actually_read = static_cast<u32>(fread(ptr, 1, count, host_file.file.GetHandle()));
 
-  if (actually_read != count && ferror(handle->host_file->GetHandle()))
+  if (actually_read != count && ferror(host_file.file.GetHandle()))
+  {
+    host_file.position.reset();
     return ResultCode::AccessDenied;
+  }
 
   // IOS returns the number of bytes read and adds that value to the seek position,
   // instead of adding the *requested* read length.
   handle->file_offset += actually_read;
+  host_file.position = handle->file_offset;
   return actually_read;
 }
 
 Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   if ((u8(handle->mode) & u8(Mode::Write)) == 0)
     return ResultCode::AccessDenied;
 
+  HostFile& host_file = *handle->host_file;
+
   // File might be opened twice, need to seek before we read
-  handle->host_file->Seek(handle->file_offset, File::SeekOrigin::Begin);
-  if (!handle->host_file->WriteBytes(ptr, count))
+  host_file.PrepareAccess(handle->file_offset, true);
+  if (!host_file.file.WriteBytes(ptr, count))
+  {
+    host_file.position.reset();
     return ResultCode::AccessDenied;
+  }
 
   handle->file_offset += count;
+  host_file.position = handle->file_offset;
+
+  const u64 old_size = host_file.size;
+  host_file.size = std::max<u64>(old_size, handle->file_offset);
+
+  const u64 old_clusters = Common::AlignUp(old_size, CLUSTER_SIZE) / CLUSTER_SIZE;
+  const u64 new_clusters = Common::AlignUp(host_file.size, CLUSTER_SIZE) / CLUSTER_SIZE;
+  if (new_clusters != old_clusters)
+    UpdateDirectoryStats(handle->wii_path, true, 0, new_clusters - old_clusters);
+
   return count;
 }
 
 Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
 {
   Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   u32 new_position = 0;
@@ -179,14 +223,14 @@ Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
     new_position = handle->file_offset + offset;
     break;
   case SeekMode::End:
-    new_position = handle->host_file->GetSize() + offset;
+    new_position = handle->host_file->size + offset;
     break;
   default:
     return ResultCode::Invalid;
   }
 
   // This differs from POSIX behaviour which allows seeking past the end of the file.
-  if (handle->host_file->GetSize() < new_position)
+  if (handle->host_file->size < new_position)
     return ResultCode::Invalid;
 
   handle->file_offset = new_position;
@@ -196,15 +240,35 @@ Result<u32> HostFileSystem::SeekFile(Fd fd, std::uint32_t offset, SeekMode mode)
 Result<FileStatus> HostFileSystem::GetFileStatus(Fd fd)
 {
   const Handle* handle = GetHandleFromFd(fd);
-  if (!handle || !handle->host_file->IsOpen())
+  if (!handle || !handle->host_file->file.IsOpen())
     return ResultCode::Invalid;
 
   FileStatus status;
-  status.size = handle->host_file->GetSize();
+  status.size = handle->host_file->size;
   status.offset = handle->file_offset;
   return status;
 }
 
+u64 HostFileSystem::GetHostFileSize(const std::string& host_path) const
+{
+  const auto it = m_open_files.find(host_path);
+  if (it != m_open_files.end())
+  {
+    if (const std::shared_ptr<HostFile> host_file = it->second.lock())
+      return host_file->size;
+  }
+  return File::GetSize(host_path);
+}
+
+void HostFileSystem::FlushHostFiles()
+{
+  for (const auto& [host_path, weak_host_file] : m_open_files)
+  {
+    if (const std::shared_ptr<HostFile> host_file = weak_host_file.lock())
+      host_file->file.Flush();
+  }
+}
+
 HostFileSystem::Handle* HostFileSystem::AssignFreeHandle()
 {
   const auto it =
@@ -845,6 +845,8 @@ void EmulationKernel::UpdateIPC()
 
 void EmulationKernel::UpdateDevices()
 {
+  m_fs->Update();
+
   // Check if a hardware device must be updated
   for (const auto& entry : m_device_map)
   {
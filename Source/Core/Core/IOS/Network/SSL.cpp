@@ -86,6 +86,21 @@ int SSLRecv(void* ctx, unsigned char* buf, size_t len)
 
   return ret;
 }
+
+void FreeSSL(WII_SSL& ssl)
+{
+  mbedtls_x509_crt_free(&ssl.cacert);
+
+  mbedtls_ssl_session_free(&ssl.session);
+  mbedtls_ssl_free(&ssl.ctx);
+  mbedtls_ssl_config_free(&ssl.config);
+  mbedtls_ctr_drbg_free(&ssl.ctr_drbg);
+  mbedtls_entropy_free(&ssl.entropy);
+
+  ssl.hostname.clear();
+
+  ssl.active = false;
+}
 }  // namespace
 
 NetSSLDevice::NetSSLDevice(EmulationKernel& ios, const std::string& device_name)
@@ -105,21 +120,16 @@ NetSSLDevice::~NetSSLDevice()
     if (ssl.active)
     {
       mbedtls_ssl_close_notify(&ssl.ctx);
-
-      mbedtls_x509_crt_free(&ssl.cacert);
-      mbedtls_x509_crt_free(&ssl.clicert);
-
-      mbedtls_ssl_session_free(&ssl.session);
-      mbedtls_ssl_free(&ssl.ctx);
-      mbedtls_ssl_config_free(&ssl.config);
-      mbedtls_ctr_drbg_free(&ssl.ctr_drbg);
-      mbedtls_entropy_free(&ssl.entropy);
-
-      ssl.hostname.clear();
-
-      ssl.active = false;
+      FreeSSL(ssl);
     }
   }
+
+  for (auto& entry : m_sessions)
+    mbedtls_ssl_session_free(&entry.second.session);
+
+  mbedtls_x509_crt_free(&m_builtin_root_ca);
+  mbedtls_x509_crt_free(&m_builtin_client_cert);
+  mbedtls_pk_free(&m_builtin_client_key);
 }
 
 int NetSSLDevice::GetSSLFreeID() const
@@ -188,6 +198,76 @@ static std::vector<u8> ReadCertFile(const std::string& path, const std::array<u8
   return bytes;
 }
 
+bool NetSSLDevice::LoadBuiltinRootCA()
+{
+  if (m_builtin_root_ca_loaded)
+    return true;
+
+  const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
+  std::vector<u8> root_ca =
+      ReadCertFile(cert_base_path + "/rootca.pem", s_root_ca_hash, m_cert_error_shown);
+  if (root_ca.empty())
+    m_cert_error_shown = true;
+
+  const int ret = mbedtls_x509_crt_parse(&m_builtin_root_ca, root_ca.data(), root_ca.size());
+  if (ret)
+  {
+    ERROR_LOG_FMT(IOS_SSL, "Failed to parse the built-in root CA: {}", ret);
+    mbedtls_x509_crt_free(&m_builtin_root_ca);
+    return false;
+  }
+
+  m_builtin_root_ca_data = std::move(root_ca);
+  m_builtin_root_ca_loaded = true;
+  return true;
+}
+
+bool NetSSLDevice::LoadBuiltinClientCert()
+{
+  if (m_builtin_client_cert_loaded)
+    return true;
+
+  const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
+  const std::vector<u8> client_cert =
+      ReadCertFile(cert_base_path + "/clientca.pem", s_client_cert_hash, m_cert_error_shown);
+  const std::vector<u8> client_key =
+      ReadCertFile(cert_base_path + "/clientcakey.pem", s_client_key_hash, m_cert_error_shown);
+  // If any of the required files fail to load, show a panic alert, but only once
+  // per IOS instance (usually once per emulation session).
+  if (client_cert.empty() || client_key.empty())
+    m_cert_error_shown = true;
+
+  const int ret =
+      mbedtls_x509_crt_parse(&m_builtin_client_cert, client_cert.data(), client_cert.size());
+  const int pk_ret = mbedtls_pk_parse_key(&m_builtin_client_key, client_key.data(),
+                                          client_key.size(), nullptr, 0);
+  if (ret || pk_ret)
+  {
+    ERROR_LOG_FMT(IOS_SSL, "Failed to parse the built-in client certificate: ({}, {})", ret,
+                  pk_ret);
+    mbedtls_x509_crt_free(&m_builtin_client_cert);
+    mbedtls_pk_free(&m_builtin_client_key);
+    return false;
+  }
+
+  m_builtin_client_cert_loaded = true;
+  return true;
+}
+
+void NetSSLDevice::CacheSession(WII_SSL& ssl)
+{
+  if (!ssl.session_established)
+    return;
+
+  CachedSession& cached = m_sessions[ssl.hostname];
+  mbedtls_ssl_session_free(&cached.session);
+  // Take ownership of the session's allocations instead of copying them.
+  cached.session = ssl.session;
+  mbedtls_ssl_session_init(&ssl.session);
+  cached.verified = ssl.config.authmode == MBEDTLS_SSL_VERIFY_REQUIRED;
+  ssl.session_established = false;
+}
+
 std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
 {
   u32 BufferIn = 0, BufferIn2 = 0, BufferIn3 = 0;
@@ -271,7 +351,9 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       mbedtls_ssl_conf_max_version(&ssl->config, MBEDTLS_SSL_MAJOR_VERSION_3,
                                    MBEDTLS_SSL_MINOR_VERSION_2);
       mbedtls_ssl_conf_cert_profile(&ssl->config, &mbedtls_x509_crt_profile_wii);
-      mbedtls_ssl_set_session(&ssl->ctx, &ssl->session);
+      mbedtls_ssl_session_init(&ssl->session);
+      ssl->session_established = false;
+      ssl->builtin_root_ca = false;
 
       if (Config::Get(Config::MAIN_NETWORK_SSL_VERIFY_CERTIFICATES) && verifyOption)
         mbedtls_ssl_conf_authmode(&ssl->config, MBEDTLS_SSL_VERIFY_REQUIRED);
@@ -307,19 +389,8 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       WII_SSL* ssl = &_SSL[sslID];
 
       mbedtls_ssl_close_notify(&ssl->ctx);
-
-      mbedtls_x509_crt_free(&ssl->cacert);
-      mbedtls_x509_crt_free(&ssl->clicert);
-
-      mbedtls_ssl_session_free(&ssl->session);
-      mbedtls_ssl_free(&ssl->ctx);
-      mbedtls_ssl_config_free(&ssl->config);
-      mbedtls_ctr_drbg_free(&ssl->ctr_drbg);
-      mbedtls_entropy_free(&ssl->entropy);
-
-      ssl->hostname.clear();
-
-      ssl->active = false;
+      CacheSession(*ssl);
+      FreeSSL(*ssl);
 
       WriteReturnValue(memory, SSL_OK, BufferIn);
     }
@@ -350,6 +421,13 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
+      if (ssl->builtin_root_ca)
+      {
+        // Keep the built-in root CA in the chain alongside the custom one.
+        mbedtls_x509_crt_parse(&ssl->cacert, m_builtin_root_ca_data.data(),
+                               m_builtin_root_ca_data.size());
+        ssl->builtin_root_ca = false;
+      }
       int ret = mbedtls_x509_crt_parse_der(
           &ssl->cacert, memory.GetPointerForRange(BufferOut2, BufferOutSize2), BufferOutSize2);
 
@@ -392,31 +470,18 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
-      const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
-      const std::vector<u8> client_cert =
-          ReadCertFile(cert_base_path + "/clientca.pem", s_client_cert_hash, m_cert_error_shown);
-      const std::vector<u8> client_key =
-          ReadCertFile(cert_base_path + "/clientcakey.pem", s_client_key_hash, m_cert_error_shown);
-      // If any of the required files fail to load, show a panic alert, but only once
-      // per IOS instance (usually once per emulation session).
-      if (client_cert.empty() || client_key.empty())
-        m_cert_error_shown = true;
-
-      int ret = mbedtls_x509_crt_parse(&ssl->clicert, client_cert.data(), client_cert.size());
-      int pk_ret = mbedtls_pk_parse_key(&ssl->pk, client_key.data(), client_key.size(), nullptr, 0);
-      if (ret || pk_ret)
+      const bool loaded = LoadBuiltinClientCert();
+      if (!loaded)
       {
-        mbedtls_x509_crt_free(&ssl->clicert);
-        mbedtls_pk_free(&ssl->pk);
         WriteReturnValue(memory, SSL_ERR_FAILED, BufferIn);
       }
       else
       {
-        mbedtls_ssl_conf_own_cert(&ssl->config, &ssl->clicert, &ssl->pk);
+        mbedtls_ssl_conf_own_cert(&ssl->config, &m_builtin_client_cert, &m_builtin_client_key);
         WriteReturnValue(memory, SSL_OK, BufferIn);
       }
 
-      INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_SETBUILTINCLIENTCERT = ({}, {})", ret, pk_ret);
+      INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_SETBUILTINCLIENTCERT = {}", loaded);
     }
     else
     {
@@ -439,9 +504,6 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
-      mbedtls_x509_crt_free(&ssl->clicert);
-      mbedtls_pk_free(&ssl->pk);
-
       mbedtls_ssl_conf_own_cert(&ssl->config, nullptr, nullptr);
       WriteReturnValue(memory, SSL_OK, BufferIn);
     }
@@ -458,23 +520,29 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
-      const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
-      const std::vector<u8> root_ca =
-          ReadCertFile(cert_base_path + "/rootca.pem", s_root_ca_hash, m_cert_error_shown);
-      if (root_ca.empty())
-        m_cert_error_shown = true;
+      int ret = LoadBuiltinRootCA() ? 0 : SSL_ERR_FAILED;
+      if (ret == 0 && ssl->cacert.version != 0)
+      {
+        // A custom root CA was set already, so the built-in one has to join its chain.
+        ret = mbedtls_x509_crt_parse(&ssl->cacert, m_builtin_root_ca_data.data(),
+                                     m_builtin_root_ca_data.size());
+      }
 
-      int ret = mbedtls_x509_crt_parse(&ssl->cacert, root_ca.data(), root_ca.size());
       if (ret)
       {
-        mbedtls_x509_crt_free(&ssl->clicert);
         WriteReturnValue(memory, SSL_ERR_FAILED, BufferIn);
       }
-      else
+      else if (ssl->cacert.version != 0)
       {
         mbedtls_ssl_conf_ca_chain(&ssl->config, &ssl->cacert, nullptr);
         WriteReturnValue(memory, SSL_OK, BufferIn);
       }
+      else
+      {
+        ssl->builtin_root_ca = true;
+        mbedtls_ssl_conf_ca_chain(&ssl->config, &m_builtin_root_ca, nullptr);
+        WriteReturnValue(memory, SSL_OK, BufferIn);
+      }
       INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_SETBUILTINROOTCA = {}", ret);
     }
     else
@@ -497,6 +565,15 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     {
       WII_SSL* ssl = &_SSL[sslID];
       mbedtls_ssl_setup(&ssl->ctx, &ssl->config);
+
+      // Only resume sessions whose server certificate was verified if verification is required.
+      const auto cached = m_sessions.find(ssl->hostname);
+      if (cached != m_sessions.end() &&
+          (cached->second.verified || ssl->config.authmode != MBEDTLS_SSL_VERIFY_REQUIRED))
+      {
+        mbedtls_ssl_set_session(&ssl->ctx, &cached->second.session);
+      }
+
       ssl->sockfd = memory.Read_U32(BufferOut2);
       ssl->hostfd = GetEmulationKernel().GetSocketManager()->GetHostSocket(ssl->sockfd);
       INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_CONNECT socket = {}", ssl->sockfd);
@@ -13,7 +13,9 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/x509_crt.h>
+#include <map>
 #include <string>
+#include <vector>
 
 // clang-format on
 
@@ -71,12 +73,14 @@ struct WII_SSL
   mbedtls_entropy_context entropy{};
   mbedtls_ctr_drbg_context ctr_drbg{};
   mbedtls_x509_crt cacert{};
-  mbedtls_x509_crt clicert{};
-  mbedtls_pk_context pk{};
   int sockfd = -1;
   int hostfd = -1;
   std::string hostname;
   bool active = false;
+  // Whether the shared built-in root CA is used instead of cacert.
+  bool builtin_root_ca = false;
+  // Whether session holds the parameters of a completed handshake, for resumption.
+  bool session_established = false;
 };
 
 class NetSSLDevice : public EmulationDevice
@@ -94,7 +98,29 @@ public:
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
+  struct CachedSession
+  {
+    mbedtls_ssl_session session{};
+    bool verified = false;
+  };
+
+  bool LoadBuiltinRootCA();
+  bool LoadBuiltinClientCert();
+  void CacheSession(WII_SSL& ssl);
+
   bool m_cert_error_shown = false;
+
+  // The built-in certificates are only read and parsed once, then shared by all SSL contexts.
+  std::vector<u8> m_builtin_root_ca_data;
+  mbedtls_x509_crt m_builtin_root_ca{};
+  mbedtls_x509_crt m_builtin_client_cert{};
+  mbedtls_pk_context m_builtin_client_key{};
+  bool m_builtin_root_ca_loaded = false;
+  bool m_builtin_client_cert_loaded = false;
+
+  // Sessions of the last completed handshake with each hostname. They are offered to the server
+  // when connecting to that hostname again, so that it can skip the full handshake.
+  std::map<std::string, CachedSession> m_sessions;
 };
 
 constexpr bool IsSSLIDValid(int id)
@@ -5,6 +5,7 @@
 #include "Core/IOS/Network/Socket.h"
 
 #include <algorithm>
+#include <array>
 #include <numeric>
 
 #include <mbedtls/error.h>
@@ -15,6 +16,9 @@
 #ifdef __HAIKU__
 #include <sys/select.h>
 #endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 
 #include "Common/BitUtils.h"
 #include "Common/FileUtil.h"
@@ -88,9 +92,21 @@ static s32 TranslateErrorCode(s32 native_error, bool is_rw)
 
 WiiSockMan::WiiSockMan(EmulationKernel& ios) : m_ios(ios)
 {
+#ifdef __linux__
+  m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (m_epoll_fd < 0)
+    ERROR_LOG_FMT(IOS_NET, "Failed to create epoll instance, falling back to polling every socket");
+#endif
 }
 
-WiiSockMan::~WiiSockMan() = default;
+WiiSockMan::~WiiSockMan()
+{
+  Clean();
+#ifdef __linux__
+  if (m_epoll_fd >= 0)
+    close(m_epoll_fd);
+#endif
+}
 
 // Don't use string! (see https://github.com/dolphin-emu/dolphin/pull/3143)
 s32 WiiSockMan::GetNetErrorCode(s32 ret, std::string_view caller, bool is_rw)
@@ -215,6 +231,7 @@ s32 WiiSocket::CloseFd()
   s32 ReturnValue = 0;
   if (fd >= 0)
   {
+    m_socket_manager.UnregisterSocketEvents(*this);
     s32 ret = closesocket(fd);
     ReturnValue = m_socket_manager.GetNetErrorCode(ret, "CloseFd", false);
   }
@@ -261,7 +278,7 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+void WiiSocket::Update()
 {
   auto& system = m_socket_manager.m_ios.GetSystem();
   auto& memory = system.GetMemory();
@@ -423,7 +440,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
               break;
             }
 
-            mbedtls_ssl_context* ctx = &NetSSLDevice::_SSL[sslID].ctx;
+            WII_SSL& ssl = NetSSLDevice::_SSL[sslID];
+            mbedtls_ssl_context* ctx = &ssl.ctx;
             const int ret = mbedtls_ssl_handshake(ctx);
             if (ret != 0)
             {
@@ -434,6 +452,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
             switch (ret)
             {
             case 0:
+              // Remember the session so that later connections to this host can resume it.
+              ssl.session_established = mbedtls_ssl_get_session(ctx, &ssl.session) == 0;
               WriteReturnValue(memory, SSL_OK, BufferIn);
               break;
             case MBEDTLS_ERR_SSL_WANT_READ:
@@ -856,6 +876,7 @@ void WiiSocket::DoSock(Request request, NET_IOCTL type)
   sockop so = {request, false};
   so.net_type = type;
   pending_sockops.push_back(so);
+  has_events = true;
 }
 
 void WiiSocket::DoSock(Request request, SSL_IOCTL type)
@@ -863,6 +884,7 @@ void WiiSocket::DoSock(Request request, SSL_IOCTL type)
   sockop so = {request, true};
   so.ssl_type = type;
   pending_sockops.push_back(so);
+  has_events = true;
 }
 
 s32 WiiSockMan::AddSocket(s32 fd, bool is_rw)
@@ -892,6 +914,7 @@ s32 WiiSockMan::AddSocket(s32 fd, bool is_rw)
     WiiSocket& sock = WiiSockets.emplace(wii_fd, *this).first->second;
     sock.SetFd(fd);
     sock.SetWiiFd(wii_fd);
+    RegisterSocketEvents(sock);
     m_ios.GetSystem().GetPowerPC().GetDebugInterface().NetworkLogger()->OnNewSocket(fd);
 
 #ifdef __APPLE__
@@ -994,58 +1017,113 @@ void WiiSockMan::EnqueueIPCReply(const Request& request, s32 return_value) const
   m_ios.EnqueueIPCReply(request, return_value);
 }
 
+void WiiSockMan::RegisterSocketEvents(WiiSocket& socket)
+{
+#ifdef __linux__
+  if (m_epoll_fd < 0)
+    return;
+
+  // Edge-triggered, so that sockets which stay writable or readable are only reported once.
+  // Operations are retried until they would block, which is what rearms the notification.
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLOUT | EPOLLPRI | EPOLLRDHUP | EPOLLET;
+  event.data.u32 = static_cast<u32>(socket.wii_fd);
+  if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, socket.fd, &event) != 0)
+  {
+    ERROR_LOG_FMT(IOS_NET, "Failed to add socket {} to epoll set: {}", socket.wii_fd,
+                  Common::StrNetworkError());
+    return;
+  }
+  socket.event_registered = true;
+#endif
+}
+
+void WiiSockMan::UnregisterSocketEvents(WiiSocket& socket)
+{
+#ifdef __linux__
+  if (!socket.event_registered)
+    return;
+
+  epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, socket.fd, nullptr);
+  socket.event_registered = false;
+#endif
+}
+
+bool WiiSockMan::ProcessSocketEvents()
+{
+#ifdef __linux__
+  if (m_epoll_fd < 0)
+    return false;
+
+  std::array<epoll_event, 64> events;
+  int count;
+  do
+  {
+    count = epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), 0);
+    for (int i = 0; i < count; ++i)
+    {
+      const auto socket_entry = WiiSockets.find(static_cast<s32>(events[i].data.u32));
+      if (socket_entry != WiiSockets.end())
+        socket_entry->second.has_events = true;
+    }
+  } while (count == static_cast<int>(events.size()));
+
+  return count >= 0;
+#else
+  return false;
+#endif
+}
+
 void WiiSockMan::Update()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
+  const bool event_driven = ProcessSocketEvents();
+  const auto now = std::chrono::steady_clock::now();
 
   auto socket_iter = WiiSockets.begin();
   auto end_socks = WiiSockets.end();
 
   while (socket_iter != end_socks)
   {
-    const WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
-    {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
-      ++socket_iter;
-    }
-    else
+    WiiSocket& sock = socket_iter->second;
+    if (!sock.IsValid())
     {
       // Good time to clean up invalid sockets.
       socket_iter = WiiSockets.erase(socket_iter);
+      continue;
     }
-  }
-
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
 
-  if (ret >= 0)
-  {
-    for (auto& pair : WiiSockets)
+    // Pending blocking operations only need to be retried once the host socket's state changed,
+    // or to let them time out.
+    if (!event_driven || !sock.event_registered || sock.has_events ||
+        (sock.timeout.has_value() && now > *sock.timeout))
     {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
+      sock.Update();
     }
+    ++socket_iter;
   }
-  else
+
+  UpdatePollCommands(event_driven);
+
+  for (auto& pair : WiiSockets)
+    pair.second.has_events = false;
+}
+
+bool WiiSockMan::HasPollEvents(const PollCommand& pcmd) const
+{
+  auto& memory = m_ios.GetSystem().GetMemory();
+  for (u32 i = 0; i < pcmd.wii_fds.size(); ++i)
   {
-    for (auto& elem : WiiSockets)
+    const auto socket_entry = WiiSockets.find(memory.Read_U32(pcmd.buffer_out + 0xc * i));
+    if (socket_entry == WiiSockets.end() || !socket_entry->second.event_registered ||
+        socket_entry->second.has_events)
     {
-      elem.second.Update(false, false, false);
+      return true;
     }
   }
-  UpdatePollCommands();
+  return false;
 }
 
-void WiiSockMan::UpdatePollCommands()
+void WiiSockMan::UpdatePollCommands(bool event_driven)
 {
   static constexpr int error_event = (POLLHUP | POLLERR);
 
@@ -1067,7 +1145,7 @@ void WiiSockMan::UpdatePollCommands()
   auto& system = m_ios.GetSystem();
   auto& memory = system.GetMemory();
 
-  std::erase_if(pending_polls, [&system, &memory, this](PollCommand& pcmd) {
+  std::erase_if(pending_polls, [&system, &memory, event_driven, this](PollCommand& pcmd) {
     const auto request = Request(system, pcmd.request_addr);
     auto& pfds = pcmd.wii_fds;
     int ret = 0;
@@ -1077,8 +1155,15 @@ void WiiSockMan::UpdatePollCommands()
     {
       ret = static_cast<int>(pfds.size());
     }
+    else if (event_driven && pcmd.polled && pcmd.timeout != 0 && !HasPollEvents(pcmd))
+    {
+      // None of the sockets changed state since they were last found not ready.
+      return false;
+    }
     else
     {
+      pcmd.polled = true;
+
       // Make the behavior of poll consistent across platforms by not passing:
       //  - Set with invalid fds, revents is set to 0 (Linux) or POLLNVAL (Windows)
       //  - Set without a valid socket, raises an error on Windows
@@ -222,7 +222,7 @@ private:
 
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
-  void Update(bool read, bool write, bool except);
+  void Update();
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
@@ -237,6 +237,13 @@ private:
   std::list<sockop> pending_sockops;
 
   std::optional<Timeout> timeout;
+
+  // Whether the host socket is in the socket manager's event set. Sockets which are not are
+  // updated on every tick, as the manager can't tell when they become ready.
+  bool event_registered = false;
+  // Set when the host socket's readiness may have changed or a new operation was queued
+  // since the last update. Cleared at the end of every WiiSockMan::Update.
+  bool has_events = false;
 };
 
 class WiiSockMan
@@ -254,6 +261,7 @@ public:
     u32 buffer_out = 0;
     std::vector<pollfd_t> wii_fds;
     s64 timeout = 0;
+    bool polled = false;
   };
 
   explicit WiiSockMan(EmulationKernel& ios);
@@ -303,11 +311,20 @@ public:
   void UpdateWantDeterminism(bool want);
 
 private:
-  void UpdatePollCommands();
+  bool ProcessSocketEvents();
+  void RegisterSocketEvents(WiiSocket& socket);
+  void UnregisterSocketEvents(WiiSocket& socket);
+  bool HasPollEvents(const PollCommand& pcmd) const;
+  void UpdatePollCommands(bool event_driven);
 
   friend class WiiSocket;
 
   EmulationKernel& m_ios;
+#ifdef __linux__
+  // Persistent edge-triggered epoll set of all host sockets, so that an update only has to look
+  // at the sockets whose state changed instead of polling every one of them.
+  int m_epoll_fd = -1;
+#endif
   std::unordered_map<s32, WiiSocket> WiiSockets;
   s32 errno_last = 0;
   std::vector<PollCommand> pending_polls;
@@ -8,4 +8,7 @@ namespace EMM
 void InstallExceptionHandler();
 void UninstallExceptionHandler();
 bool IsExceptionHandlerSupported();
+
+// Whether faults on threads other than the one which installed the handler are handled too.
+bool IsExceptionHandlerProcessWide();
 }  // namespace EMM
@@ -3,6 +3,7 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <bit>
 #include <span>
 #include <sstream>
 #include <utility>
@@ -22,6 +23,7 @@
 #include "Core/PowerPC/Gekko.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -206,6 +208,80 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::LoadImmediate(PowerPC::PowerPCState& ppc_state,
+                                     const LoadImmediateOperands& operands)
+{
+  const auto& [rD, imm] = operands;
+  rD = imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(PowerPC::PowerPCState& ppc_state,
+                                    const AddImmediateOperands& operands)
+{
+  const auto& [rD, rA, imm] = operands;
+  rD = rA + imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMask(PowerPC::PowerPCState& ppc_state,
+                                         const RotateLeftAndMaskOperands& operands)
+{
+  const auto& [rA, rS, sh, mask] = operands;
+  rA = std::rotl(rS, sh) & mask;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMaskTwice(PowerPC::PowerPCState& ppc_state,
+                                              const RotateLeftAndMaskTwiceOperands& operands)
+{
+  const auto& [rA1, rA2, rS, sh1, mask1, sh2, mask2] = operands;
+  const u32 temp = std::rotl(rS, sh1) & mask1;
+  rA1 = temp;
+  rA2 = std::rotl(temp, sh2) & mask2;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadWord(PowerPC::PowerPCState& ppc_state, const LoadWordOperands& operands)
+{
+  const auto& [mmu, rD, rA, offset] = operands;
+  const u32 temp = mmu.Read_U32(rA + offset);
+  if (!(ppc_state.Exceptions & EXCEPTION_DSI))
+    rD = temp;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediateAndLoadWord(PowerPC::PowerPCState& ppc_state,
+                                               const AddImmediateAndLoadWordOperands& operands)
+{
+  const auto& [mmu, rX, rY, rD, imm, offset] = operands;
+  const u32 address = rY + imm;
+  rX = address;
+  const u32 temp = mmu.Read_U32(address + offset);
+  if (!(ppc_state.Exceptions & EXCEPTION_DSI))
+    rD = temp;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool signed_compare>
+s32 CachedInterpreter::CompareAndBranch(PowerPC::PowerPCState& ppc_state,
+                                        const CompareAndBranchOperands& operands)
+{
+  const auto& [rA, imm, crf, bi, current_pc, target, branch_if_set] = operands;
+  using T = std::conditional_t<signed_compare, s32, u32>;
+  const T a = static_cast<T>(rA);
+  const T b = static_cast<T>(imm);
+
+  u32 cr_field = a < b ? PowerPC::CR_LT : a > b ? PowerPC::CR_GT : PowerPC::CR_EQ;
+  if (ppc_state.GetXER_SO())
+    cr_field |= PowerPC::CR_SO;
+  ppc_state.cr.SetField(crf, cr_field);
+
+  ppc_state.pc = current_pc;
+  ppc_state.npc = ppc_state.cr.GetBit(bi) == branch_if_set ? target : current_pc + 4;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -237,6 +313,116 @@ void CachedInterpreter::WriteEndBlock()
   }
 }
 
+bool CachedInterpreter::CanFuseNextInstruction() const
+{
+  if (!CanMergeNextInstructions(1))
+    return false;
+
+  // The next instruction must not need any checks of its own in between.
+  const PPCAnalyst::CodeOp& next = js.op[1];
+  if (next.skip || (next.opinfo->flags & FL_USE_FPU) != 0)
+    return false;
+  return !HLE::TryReplaceFunction(m_ppc_symbol_db, next.address, PowerPC::CoreMode::JIT);
+}
+
+u32 CachedInterpreter::WriteFusedInstructions()
+{
+  const UGeckoInstruction inst = js.op->inst;
+  const UGeckoInstruction next = js.instructionsLeft > 0 ? js.op[1].inst : UGeckoInstruction{};
+  auto& gpr = m_ppc_state.gpr;
+
+  switch (inst.OPCD)
+  {
+  case 14:  // addi
+  case 15:  // addis
+  {
+    const u32 imm = inst.OPCD == 14 ? u32(inst.SIMM_16) : u32(inst.SIMM_16 << 16);
+    if (inst.RA == 0)
+    {
+      // lis rD, hi; addi rD, rD, lo / lis rD, hi; ori rD, rD, lo
+      if (inst.OPCD == 15 && CanFuseNextInstruction())
+      {
+        // addi with rA = 0 adds to a literal 0 instead of r0.
+        if (next.OPCD == 14 && inst.RD != 0 && next.RD == inst.RD && next.RA == inst.RD)
+        {
+          Write(LoadImmediate, {gpr[inst.RD], imm + u32(next.SIMM_16)});
+          return 2;
+        }
+        if (next.OPCD == 24 && next.RS == inst.RD && next.RA == inst.RD)
+        {
+          Write(LoadImmediate, {gpr[inst.RD], imm | next.UIMM});
+          return 2;
+        }
+      }
+      Write(LoadImmediate, {gpr[inst.RD], imm});
+      return 1;
+    }
+
+    // addi rX, rY, imm; lwz rD, offset(rX). lwz with rA = 0 uses a literal 0 base instead of r0.
+    if (!jo.memcheck && next.OPCD == 32 && inst.RD != 0 && next.RA == inst.RD &&
+        CanFuseNextInstruction())
+    {
+      Write(AddImmediateAndLoadWord, {m_mmu, gpr[inst.RD], gpr[inst.RA], gpr[next.RD], imm,
+                                      u32(next.SIMM_16)});
+      return 2;
+    }
+    Write(AddImmediate, {gpr[inst.RD], gpr[inst.RA], imm});
+    return 1;
+  }
+
+  case 21:  // rlwinmx
+  {
+    if (inst.Rc)
+      return 0;
+    const u32 mask = MakeRotationMask(inst.MB, inst.ME);
+    if (next.OPCD == 21 && !next.Rc && next.RS == inst.RA && CanFuseNextInstruction())
+    {
+      Write(RotateLeftAndMaskTwice, {gpr[inst.RA], gpr[next.RA], gpr[inst.RS], inst.SH, mask,
+                                     next.SH, MakeRotationMask(next.MB, next.ME)});
+      return 2;
+    }
+    Write(RotateLeftAndMask, {gpr[inst.RA], gpr[inst.RS], inst.SH, mask});
+    return 1;
+  }
+
+  case 32:  // lwz
+    if (jo.memcheck || inst.RA == 0)
+      return 0;
+    Write(LoadWord, {m_mmu, gpr[inst.RD], gpr[inst.RA], u32(inst.SIMM_16)});
+    return 1;
+
+  case 10:  // cmpli
+  case 11:  // cmpi
+  {
+    // cmpwi crfD, rA, imm; bc BO, BI, target. Only branches which neither touch CTR nor LR are
+    // fused, and not while debugging so that BranchWatch still sees them.
+    if (IsDebuggingEnabled() || next.OPCD != 16 || next.LK ||
+        (next.BO & BO_DONT_DECREMENT_FLAG) == 0 || (next.BO & BO_DONT_CHECK_CONDITION) != 0 ||
+        !CanFuseNextInstruction() || !js.op[1].canEndBlock)
+    {
+      return 0;
+    }
+
+    const PPCAnalyst::CodeOp& next_op = js.op[1];
+
+    u32 target = u32(SignExt16(s16(next.BD << 2)));
+    if (!next.AA)
+      target += next_op.address;
+    const u32 imm = inst.OPCD == 11 ? u32(s32{inst.SIMM_16}) : u32{inst.UIMM};
+    const u32 branch_if_set = (next.BO >> 3) & 1;
+    const CompareAndBranchOperands operands = {
+        gpr[inst.RA], imm, inst.CRFD, next.BI, next_op.address, target, branch_if_set};
+    Write(inst.OPCD == 11 ? CallbackCast(CompareAndBranch<true>) :
+                            CallbackCast(CompareAndBranch<false>),
+          operands);
+    return 2;
+  }
+
+  default:
+    return 0;
+  }
+}
+
 bool CachedInterpreter::SetEmitterStateToFreeCodeRegion()
 {
   const auto free = m_free_ranges.by_size_begin();
@@ -384,6 +570,19 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                CallbackCast(InterpretAndCheckExceptions<false>),
               operands);
       }
+      else if (const u32 num_fused = WriteFusedInstructions(); num_fused != 0)
+      {
+        for (u32 j = 1; j < num_fused; j++)
+        {
+          const PPCAnalyst::CodeOp& fused_op = m_code_buffer[++i];
+          js.downcountAmount += fused_op.opinfo->num_cycles;
+          if (fused_op.opinfo->flags & FL_LOADSTORE)
+            ++js.numLoadStoreInst;
+        }
+        js.op = &m_code_buffer[i];
+        js.compilerPC = js.op->address;
+        js.instructionsLeft = (code_block.m_num_instructions - 1) - i;
+      }
       else
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
@@ -392,9 +591,10 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
               operands);
       }
 
-      if (op.branchIsIdleLoop)
+      // Fused instructions are handled by their last instruction from here on.
+      if (js.op->branchIsIdleLoop)
         Write(CheckIdle, {m_system.GetCoreTiming(), js.blockStart});
-      if (op.canEndBlock)
+      if (js.op->canEndBlock)
         WriteEndBlock();
     }
   }
@@ -64,6 +64,12 @@ private:
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
 
+  // Writes a specialized callback for the instruction at js.op, possibly fused with the ones
+  // following it. Returns the number of guest instructions handled, or 0 if the instruction has to
+  // go through the regular interpreter.
+  u32 WriteFusedInstructions();
+  bool CanFuseNextInstruction() const;
+
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
   bool SetEmitterStateToFreeCodeRegion();
@@ -82,6 +88,13 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct LoadImmediateOperands;
+  struct AddImmediateOperands;
+  struct RotateLeftAndMaskOperands;
+  struct RotateLeftAndMaskTwiceOperands;
+  struct LoadWordOperands;
+  struct AddImmediateAndLoadWordOperands;
+  struct CompareAndBranchOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -112,6 +125,30 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Fused instructions. These operate directly on the guest registers baked into their operands.
+  static s32 LoadImmediate(PowerPC::PowerPCState& ppc_state, const LoadImmediateOperands& operands);
+  static s32 LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands);
+  static s32 AddImmediate(PowerPC::PowerPCState& ppc_state, const AddImmediateOperands& operands);
+  static s32 AddImmediate(std::ostream& stream, const AddImmediateOperands& operands);
+  static s32 RotateLeftAndMask(PowerPC::PowerPCState& ppc_state,
+                               const RotateLeftAndMaskOperands& operands);
+  static s32 RotateLeftAndMask(std::ostream& stream, const RotateLeftAndMaskOperands& operands);
+  static s32 RotateLeftAndMaskTwice(PowerPC::PowerPCState& ppc_state,
+                                    const RotateLeftAndMaskTwiceOperands& operands);
+  static s32 RotateLeftAndMaskTwice(std::ostream& stream,
+                                    const RotateLeftAndMaskTwiceOperands& operands);
+  static s32 LoadWord(PowerPC::PowerPCState& ppc_state, const LoadWordOperands& operands);
+  static s32 LoadWord(std::ostream& stream, const LoadWordOperands& operands);
+  static s32 AddImmediateAndLoadWord(PowerPC::PowerPCState& ppc_state,
+                                     const AddImmediateAndLoadWordOperands& operands);
+  static s32 AddImmediateAndLoadWord(std::ostream& stream,
+                                     const AddImmediateAndLoadWordOperands& operands);
+  template <bool signed_compare>
+  static s32 CompareAndBranch(PowerPC::PowerPCState& ppc_state,
+                              const CompareAndBranchOperands& operands);
+  template <bool signed_compare>
+  static s32 CompareAndBranch(std::ostream& stream, const CompareAndBranchOperands& operands);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -175,3 +212,67 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+struct CachedInterpreter::LoadImmediateOperands
+{
+  u32& rD;
+  u32 imm;
+  u32 : 32;
+};
+
+struct CachedInterpreter::AddImmediateOperands
+{
+  u32& rD;
+  const u32& rA;
+  u32 imm;
+  u32 : 32;
+};
+
+struct CachedInterpreter::RotateLeftAndMaskOperands
+{
+  u32& rA;
+  const u32& rS;
+  u32 sh;
+  u32 mask;
+};
+
+struct CachedInterpreter::RotateLeftAndMaskTwiceOperands
+{
+  u32& rA1;
+  u32& rA2;
+  const u32& rS;
+  u32 sh1;
+  u32 mask1;
+  u32 sh2;
+  u32 mask2;
+};
+
+struct CachedInterpreter::LoadWordOperands
+{
+  PowerPC::MMU& mmu;
+  u32& rD;
+  const u32& rA;
+  u32 offset;
+  u32 : 32;
+};
+
+struct CachedInterpreter::AddImmediateAndLoadWordOperands
+{
+  PowerPC::MMU& mmu;
+  u32& rX;
+  const u32& rY;
+  u32& rD;
+  u32 imm;
+  u32 offset;
+};
+
+struct CachedInterpreter::CompareAndBranchOperands
+{
+  const u32& rA;
+  u32 imm;
+  u32 crf;
+  u32 bi;
+  u32 current_pc;
+  u32 target;
+  u32 branch_if_set;
+};
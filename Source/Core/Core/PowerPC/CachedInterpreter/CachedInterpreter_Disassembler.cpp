@@ -12,6 +12,8 @@
 #include <fmt/ostream.h>
 
 #include "Core/HLE/HLE.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 s32 CachedInterpreterEmitter::PoisonCallback(std::ostream& stream, const void* operands)
 {
@@ -90,6 +92,74 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+// Fused callbacks only store references to the guest registers they use.
+static u32 GPRIndex(const u32& reg)
+{
+  return static_cast<u32>(&reg - Core::System::GetInstance().GetPPCState().gpr);
+}
+
+s32 CachedInterpreter::LoadImmediate(std::ostream& stream, const LoadImmediateOperands& operands)
+{
+  const auto& [rD, imm] = operands;
+  fmt::println(stream, "LoadImmediate(r{}, 0x{:08x})", GPRIndex(rD), imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediate(std::ostream& stream, const AddImmediateOperands& operands)
+{
+  const auto& [rD, rA, imm] = operands;
+  fmt::println(stream, "AddImmediate(r{}, r{}, 0x{:08x})", GPRIndex(rD), GPRIndex(rA), imm);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMask(std::ostream& stream,
+                                         const RotateLeftAndMaskOperands& operands)
+{
+  const auto& [rA, rS, sh, mask] = operands;
+  fmt::println(stream, "RotateLeftAndMask(r{}, r{}, sh={}, mask=0x{:08x})", GPRIndex(rA),
+               GPRIndex(rS), sh, mask);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateLeftAndMaskTwice(std::ostream& stream,
+                                              const RotateLeftAndMaskTwiceOperands& operands)
+{
+  const auto& [rA1, rA2, rS, sh1, mask1, sh2, mask2] = operands;
+  fmt::println(stream,
+               "RotateLeftAndMaskTwice(r{}, r{}, r{}, sh1={}, mask1=0x{:08x}, sh2={}, "
+               "mask2=0x{:08x})",
+               GPRIndex(rA1), GPRIndex(rA2), GPRIndex(rS), sh1, mask1, sh2, mask2);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadWord(std::ostream& stream, const LoadWordOperands& operands)
+{
+  const auto& [mmu, rD, rA, offset] = operands;
+  fmt::println(stream, "LoadWord(r{}, r{}, offset=0x{:08x})", GPRIndex(rD), GPRIndex(rA), offset);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddImmediateAndLoadWord(std::ostream& stream,
+                                               const AddImmediateAndLoadWordOperands& operands)
+{
+  const auto& [mmu, rX, rY, rD, imm, offset] = operands;
+  fmt::println(stream, "AddImmediateAndLoadWord(r{}, r{}, 0x{:08x}, r{}, offset=0x{:08x})",
+               GPRIndex(rX), GPRIndex(rY), imm, GPRIndex(rD), offset);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool signed_compare>
+s32 CachedInterpreter::CompareAndBranch(std::ostream& stream,
+                                        const CompareAndBranchOperands& operands)
+{
+  const auto& [rA, imm, crf, bi, current_pc, target, branch_if_set] = operands;
+  fmt::println(stream,
+               "CompareAndBranch<signed_compare={:5}>(cr{}, r{}, 0x{:08x}, current_pc=0x{:08x}, "
+               "target=0x{:08x}, bi={}, branch_if_set={})",
+               signed_compare, crf, GPRIndex(rA), imm, current_pc, target, bi, branch_if_set);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +185,14 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::LoadImmediate),
+      LOOKUP_KV(CachedInterpreter::AddImmediate),
+      LOOKUP_KV(CachedInterpreter::RotateLeftAndMask),
+      LOOKUP_KV(CachedInterpreter::RotateLeftAndMaskTwice),
+      LOOKUP_KV(CachedInterpreter::LoadWord),
+      LOOKUP_KV(CachedInterpreter::AddImmediateAndLoadWord),
+      LOOKUP_KV(CachedInterpreter::CompareAndBranch<false>),
+      LOOKUP_KV(CachedInterpreter::CompareAndBranch<true>),
   });
 
 #undef LOOKUP_KV
@@ -58,6 +58,18 @@ bool Interpreter::IsInvalidPairedSingleExecution(UGeckoInstruction inst)
          IsPairedSingleQuantizedNonIndexedInstruction(inst);
 }
 
+Interpreter::PredecodedInstruction Interpreter::Predecode(u32 address, UGeckoInstruction inst)
+{
+  PredecodedInstruction& entry = m_predecode_cache[(address >> 2) % PREDECODE_CACHE_SIZE];
+  if (entry.opinfo == nullptr || entry.hex != inst.hex)
+  {
+    entry.hex = inst.hex;
+    entry.func = GetInterpreterOp(inst);
+    entry.opinfo = PPCTables::GetOpInfo(inst, address);
+  }
+  return entry;
+}
+
 void Interpreter::UpdatePC()
 {
   m_last_pc = m_ppc_state.pc;
@@ -132,7 +144,8 @@ int Interpreter::SingleStepInner()
   m_ppc_state.npc = m_ppc_state.pc + sizeof(UGeckoInstruction);
   m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
 
-  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(m_prev_inst, m_ppc_state.pc);
+  const PredecodedInstruction predecoded = Predecode(m_ppc_state.pc, m_prev_inst);
+  const GekkoOPInfo* opinfo = predecoded.opinfo;
 
   // Uncomment to trace the interpreter
   // if ((m_ppc_state.pc & 0x00FFFFFF) >= 0x000AB54C &&
@@ -159,7 +172,7 @@ int Interpreter::SingleStepInner()
     }
     else if (m_ppc_state.msr.FP)
     {
-      RunInterpreterOp(*this, m_prev_inst);
+      predecoded.func(*this, m_prev_inst);
       if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
       {
         CheckExceptions();
@@ -175,7 +188,7 @@ int Interpreter::SingleStepInner()
       }
       else
       {
-        RunInterpreterOp(*this, m_prev_inst);
+        predecoded.func(*this, m_prev_inst);
         if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
         {
           CheckExceptions();
@@ -319,7 +332,7 @@ void Interpreter::unknown_instruction(Interpreter& interpreter, UGeckoInstructio
 
 void Interpreter::ClearCache()
 {
-  // Do nothing.
+  m_predecode_cache.fill({});
 }
 
 void Interpreter::CheckExceptions()
@@ -19,6 +19,7 @@ namespace PowerPC
 class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
+struct GekkoOPInfo;
 class PPCSymbolDB;
 
 class Interpreter : public CPUCoreBase
@@ -309,6 +310,19 @@ private:
   static void Helper_FloatCompareUnordered(PowerPC::PowerPCState& ppc_state, UGeckoInstruction inst,
                                            double a, double b);
 
+  // The decoded form of the instruction most recently fetched from a given address. Fetching still
+  // goes through the MMU every time, so comparing the instruction word is all it takes to detect
+  // modified code, without needing to hook icbi or memory writes.
+  struct PredecodedInstruction
+  {
+    u32 hex = 0;
+    Instruction func = nullptr;
+    const GekkoOPInfo* opinfo = nullptr;
+  };
+  static constexpr u32 PREDECODE_CACHE_SIZE = 0x4000;
+
+  PredecodedInstruction Predecode(u32 address, UGeckoInstruction inst);
+
   void UpdatePC();
   bool IsInvalidPairedSingleExecution(UGeckoInstruction inst);
 
@@ -320,6 +334,8 @@ private:
   Core::BranchWatch& m_branch_watch;
   PPCSymbolDB& m_ppc_symbol_db;
 
+  std::array<PredecodedInstruction, PREDECODE_CACHE_SIZE> m_predecode_cache{};
+
   UGeckoInstruction m_prev_inst{};
   u32 m_last_pc = 0;
   bool m_end_block = false;
@@ -3,10 +3,13 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <span>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -22,9 +25,11 @@
 #include "Common/HostDisassembler.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -156,6 +161,12 @@ bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
                    "PC {:#018x}, access address {:#018x}, memory base {:#018x}, MSR.DR {}",
                    ctx->CTX_PC, access_address, memory_base, ppc_state.msr.DR);
     }
+    else if (IsInSpace(reinterpret_cast<u8*>(ctx->CTX_PC)) &&
+             m_mmu.AddPageTableFastmemMapping(static_cast<u32>(access_address - memory_base)))
+    {
+      // The page is accessible now, so let the access run again.
+      return true;
+    }
 
     return BackPatch(ctx);
   }
@@ -274,6 +285,8 @@ void Jit64::Init()
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
   AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    Common::AdviseHugePages(region, region_size);
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -298,6 +311,11 @@ void Jit64::Init()
   code_block.m_fpa = &js.fpa;
   EnableOptimization();
 
+  m_branch_exit_counters.fill(BRANCH_EXIT_THRESHOLD);
+  m_hot_branches.clear();
+  m_cold_branches.clear();
+  analyzer.SetHotBranches(&m_hot_branches);
+
   ResetFreeMemoryRanges();
 }
 
@@ -336,6 +354,33 @@ void Jit64::ResetFreeMemoryRanges()
   m_free_ranges_far.insert(m_far_code.GetWritableCodePtr(), m_far_code.GetWritableCodeEnd());
 }
 
+void Jit64::EvictBlocksIfLowOnCodeSpace()
+{
+  // Like CodeBlock::IsAlmostFull, this should be bigger than the biggest block ever.
+  constexpr std::ptrdiff_t MIN_FREE_REGION_SIZE = 0x10000;
+  const auto has_free_region = [](const HyoutaUtilities::RangeSizeSet<u8*>& free_ranges) {
+    const auto largest = free_ranges.by_size_begin();
+    return largest != free_ranges.by_size_end() &&
+           largest.to() - largest.from() >= MIN_FREE_REGION_SIZE;
+  };
+
+  // Instead of waiting for code generation to fail and clearing the whole cache, which causes a
+  // noticeable hitch, evict the oldest quarter of the blocks whenever the largest free regions get
+  // small. Hot blocks are recompiled on their next execution and then count as young again.
+  while (!has_free_region(m_free_ranges_near) || !has_free_region(m_free_ranges_far))
+  {
+    const std::size_t block_count = blocks.GetBlockCount();
+    if (block_count == 0)
+      return;
+
+    const std::size_t evict_count = std::max<std::size_t>(block_count / 4, 1);
+    DEBUG_LOG_FMT(DYNA_REC, "Low on code space, evicting {} of {} blocks", evict_count,
+                  block_count);
+    blocks.EvictOldestBlocks(evict_count);
+    FreeRanges();
+  }
+}
+
 void Jit64::Shutdown()
 {
   FreeCodeSpace();
@@ -472,10 +517,18 @@ bool Jit64::Cleanup()
 
   if (IsProfilingEnabled())
   {
-    ABI_PushRegistersAndAdjustStack({}, 0);
-    ABI_CallFunctionPC(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
-                       js.downcountAmount);
-    ABI_PopRegistersAndAdjustStack({}, 0);
+    if (IsProfilingTimingEnabled())
+    {
+      ABI_PushRegistersAndAdjustStack({}, 0);
+      ABI_CallFunctionPC(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+                         js.downcountAmount);
+      ABI_PopRegistersAndAdjustStack({}, 0);
+    }
+    else
+    {
+      MOV(64, R(RSCRATCH), ImmPtr(&js.curBlock->profile_data->cycles_spent));
+      ADD(64, MatR(RSCRATCH), Imm32(js.downcountAmount));
+    }
     did_something = true;
   }
 
@@ -626,11 +679,173 @@ void Jit64::WriteExitDestInRSCRATCH(bool bl, u32 after)
   }
 }
 
+namespace
+{
+// Number of targets remembered per indirect branch.
+constexpr std::size_t INDIRECT_BRANCH_CACHE_ENTRIES = 2;
+// Never matches a real target, since those are word aligned. Deliberately doesn't fit in an imm8,
+// so that the comparison is always encoded with an imm32 that can be patched later.
+constexpr u32 INDIRECT_BRANCH_CACHE_EMPTY = 0x7FFFFFFF;
+// Layout of each cache entry: CMP eax, imm32; JNE rel32; exit. These are the offsets of the
+// immediate and the JNE displacement relative to the start of the exit.
+constexpr std::ptrdiff_t INDIRECT_BRANCH_CACHE_IMM_OFFSET = -10;
+constexpr std::ptrdiff_t INDIRECT_BRANCH_CACHE_JNE_OFFSET = -4;
+// Size of the exit in front of the miss handler: JMP rel32, or CALL rel32 followed by JMP rel32.
+constexpr std::ptrdiff_t INDIRECT_BRANCH_SLOW_EXIT_SIZE = 5;
+constexpr std::ptrdiff_t INDIRECT_BRANCH_SLOW_EXIT_SIZE_CALL = 10;
+}  // namespace
+
+void Jit64::WriteIndirectExitDestInRSCRATCH(bool bl, u32 after)
+{
+  // The cache entries are block links, so without block linking there is nothing to gain.
+  if (!jo.enableBlocklink)
+  {
+    WriteExitDestInRSCRATCH(bl, after);
+    return;
+  }
+
+  if (!m_enable_blr_optimization)
+    bl = false;
+  MOV(32, PPCSTATE(pc), R(RSCRATCH));
+  if (Cleanup())
+    MOV(32, R(RSCRATCH), PPCSTATE(pc));
+
+  if (bl)
+  {
+    MOV(64, R(RSCRATCH2), Imm64(u64(m_ppc_state.feature_flags) << 32 | after));
+    PUSH(RSCRATCH2);
+  }
+
+  SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
+
+  std::vector<FixupBranch> after_fixups;
+  if (bl)
+  {
+    FixupBranch do_timing = J_CC(CC_LE, Jump::Near);
+    SwitchToFarCode();
+    SetJumpTarget(do_timing);
+    CALL(asm_routines.do_timing);
+    after_fixups.push_back(J(Jump::Near));
+    SwitchToNearCode();
+  }
+  else
+  {
+    J_CC(CC_LE, asm_routines.do_timing);
+  }
+
+  // Each entry compares the target against the one it was last filled with and exits through a
+  // regular block link. The entries start out empty and are filled by UpdateIndirectBranchCache
+  // whenever all of them miss.
+  const auto write_exit = [&] {
+    if (bl)
+    {
+      CALL(asm_routines.dispatcher_no_timing_check);
+      after_fixups.push_back(J(Jump::Near));
+    }
+    else
+    {
+      JMP(asm_routines.dispatcher_no_timing_check, Jump::Near);
+    }
+  };
+
+  u8* first_exit = nullptr;
+  FixupBranch miss;
+  for (std::size_t i = 0; i < INDIRECT_BRANCH_CACHE_ENTRIES; i++)
+  {
+    if (i != 0)
+      SetJumpTarget(miss);
+    CMP(32, R(RSCRATCH), Imm32(INDIRECT_BRANCH_CACHE_EMPTY));
+    const u8* const imm_end = GetCodePtr();
+    miss = J_CC(CC_NE, Jump::Near);
+
+    JitBlock::LinkData link_data;
+    link_data.exitPtrs = GetWritableCodePtr();
+    DEBUG_ASSERT(imm_end - link_data.exitPtrs == INDIRECT_BRANCH_CACHE_IMM_OFFSET + 4);
+    link_data.exitAddress = INDIRECT_BRANCH_CACHE_EMPTY;
+    link_data.linkStatus = false;
+    link_data.call = bl;
+    js.curBlock->linkData.push_back(link_data);
+    if (i == 0)
+      first_exit = link_data.exitPtrs;
+
+    write_exit();
+  }
+
+  // When all entries miss, update the cache and go through the dispatcher. The exit comes first
+  // so that UpdateIndirectBranchCache can find it when the branch turns out to have too many
+  // targets for the cache.
+  SwitchToFarCode();
+  const u8* slow_exit = GetCodePtr();
+  write_exit();
+  DEBUG_ASSERT(GetCodePtr() - slow_exit ==
+               (bl ? INDIRECT_BRANCH_SLOW_EXIT_SIZE_CALL : INDIRECT_BRANCH_SLOW_EXIT_SIZE));
+  SetJumpTarget(miss);
+  // For bl, the return address pushed above leaves the stack 8 bytes off its usual alignment.
+  ABI_PushRegistersAndAdjustStack({}, bl ? 8 : 0);
+#if defined(_DEBUG) || defined(DEBUGFAST)
+  TEST(32, R(RSP), Imm32(0xF));
+  FixupBranch stack_aligned = J_CC(CC_Z);
+  INT3();
+  SetJumpTarget(stack_aligned);
+#endif
+  ABI_CallFunctionPPC(UpdateIndirectBranchCache, this, first_exit, js.blockStart);
+  ABI_PopRegistersAndAdjustStack({}, bl ? 8 : 0);
+  JMP(slow_exit, Jump::Near);
+  SwitchToNearCode();
+
+  if (bl)
+  {
+    for (const FixupBranch& fixup : after_fixups)
+      SetJumpTarget(fixup);
+    POP(RSCRATCH);
+    JustWriteExit(after, false, 0);
+  }
+}
+
+void Jit64::UpdateIndirectBranchCache(Jit64& jit, u8* exit_ptr, u32 block_start)
+{
+  // The block may have been invalidated while it was running, in which case the exit can't be
+  // found anymore and the cache is simply left alone.
+  JitBlock* block =
+      jit.blocks.GetBlockFromStartAddress(block_start, jit.m_ppc_state.feature_flags);
+  if (!block)
+    return;
+  const auto it = std::ranges::find(block->linkData, exit_ptr, &JitBlock::LinkData::exitPtrs);
+  if (block->linkData.end() - it < static_cast<std::ptrdiff_t>(INDIRECT_BRANCH_CACHE_ENTRIES))
+    return;
+
+  const u32 target = jit.m_ppc_state.pc;
+  const std::size_t first_index = it - block->linkData.begin();
+  for (std::size_t i = first_index; i < first_index + INDIRECT_BRANCH_CACHE_ENTRIES; i++)
+  {
+    JitBlock::LinkData& link = block->linkData[i];
+    if (link.exitAddress != INDIRECT_BRANCH_CACHE_EMPTY)
+      continue;
+
+    std::memcpy(link.exitPtrs + INDIRECT_BRANCH_CACHE_IMM_OFFSET, &target, sizeof(target));
+    jit.blocks.RelinkExit(*block, i, target);
+    return;
+  }
+
+  // All entries are taken, so this branch has more targets than the cache can hold. Send further
+  // misses straight to the dispatcher instead of paying for this call every time.
+  const JitBlock::LinkData& last = block->linkData[first_index + INDIRECT_BRANCH_CACHE_ENTRIES - 1];
+  u8* const jne_displacement = last.exitPtrs + INDIRECT_BRANCH_CACHE_JNE_OFFSET;
+  s32 displacement;
+  std::memcpy(&displacement, jne_displacement, sizeof(displacement));
+  const u8* const miss_handler = last.exitPtrs + displacement;
+  const u8* const slow_exit =
+      miss_handler -
+      (last.call ? INDIRECT_BRANCH_SLOW_EXIT_SIZE_CALL : INDIRECT_BRANCH_SLOW_EXIT_SIZE);
+  displacement = static_cast<s32>(slow_exit - last.exitPtrs);
+  std::memcpy(jne_displacement, &displacement, sizeof(displacement));
+}
+
 void Jit64::WriteBLRExit()
 {
   if (!m_enable_blr_optimization)
   {
-    WriteExitDestInRSCRATCH();
+    WriteIndirectExitDestInRSCRATCH();
     return;
   }
   MOV(32, PPCSTATE(pc), R(RSCRATCH));
@@ -663,6 +878,59 @@ void Jit64::WriteRfiExitDestInRSCRATCH()
   JMP(asm_routines.dispatcher, Jump::Near);
 }
 
+void Jit64::WriteBranchExitCounter(const PPCAnalyst::CodeOp& op)
+{
+  if (IsDebuggingEnabled() ||
+      !analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE) ||
+      !PPCAnalyst::CanFollowConditionalBranch(op.inst) || m_cold_branches.contains(op.address))
+  {
+    return;
+  }
+  // A hot branch that wasn't followed anyway (e.g. because the block was already following too
+  // many branches) has nothing to gain from counting.
+  if (!op.branchFollowed && m_hot_branches.contains(op.address))
+    return;
+
+  u32* const counter = &m_branch_exit_counters[(op.address >> 2) % BRANCH_EXIT_COUNTERS];
+  MOV(64, R(RSCRATCH), ImmPtr(counter));
+  SUB(32, MatR(RSCRATCH), Imm8(1));
+  FixupBranch frequent = J_CC(CC_Z, Jump::Near);
+  SwitchToFarCode();
+  SetJumpTarget(frequent);
+  ABI_PushRegistersAndAdjustStack({}, 0);
+  if (op.branchFollowed)
+    ABI_CallFunctionPC(OnFrequentBranchExit<true>, this, op.address);
+  else
+    ABI_CallFunctionPC(OnFrequentBranchExit<false>, this, op.address);
+  ABI_PopRegistersAndAdjustStack({}, 0);
+  FixupBranch back = J(Jump::Near);
+  SwitchToNearCode();
+  SetJumpTarget(back);
+}
+
+template <bool followed>
+void Jit64::OnFrequentBranchExit(Jit64& jit, u32 branch_address)
+{
+  jit.m_branch_exit_counters[(branch_address >> 2) % BRANCH_EXIT_COUNTERS] =
+      BRANCH_EXIT_THRESHOLD;
+
+  if constexpr (followed)
+  {
+    // The branch falls through often enough that following it was a bad guess. Go back to
+    // compiling it normally, for good, so that it can't flip back and forth.
+    jit.m_hot_branches.erase(branch_address);
+    jit.m_cold_branches.insert(branch_address);
+  }
+  else
+  {
+    jit.m_hot_branches.insert(branch_address);
+  }
+
+  // The block that's currently running is among the ones thrown away here. That's fine, as its
+  // code stays around until the next block gets compiled.
+  jit.blocks.InvalidateICache(branch_address, 4, true);
+}
+
 void Jit64::WriteIdleExit(u32 destination)
 {
   ABI_PushRegistersAndAdjustStack({}, 0);
@@ -764,6 +1032,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     ClearCache();
   }
   FreeRanges();
+  EvictBlocksIfLowOnCodeSpace();
 
   std::size_t block_size = m_code_buffer.size();
 
@@ -903,7 +1172,18 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   // Conditionally add profiling code.
   if (IsProfilingEnabled())
-    ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
+  {
+    if (IsProfilingTimingEnabled())
+    {
+      ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
+    }
+    else
+    {
+      // Only counting is cheap enough to do inline, and perturbs the profiled code much less.
+      MOV(64, R(RSCRATCH), ImmPtr(&b->profile_data->run_count));
+      ADD(64, MatR(RSCRATCH), Imm8(1));
+    }
+  }
 
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
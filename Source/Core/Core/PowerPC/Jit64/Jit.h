@@ -17,7 +17,9 @@
 // ----------
 #pragma once
 
+#include <array>
 #include <optional>
+#include <unordered_set>
 
 #include <rangeset/rangesizeset.h>
 
@@ -100,11 +102,15 @@ public:
   void WriteExit(u32 destination, bool bl = false, u32 after = 0);
   void JustWriteExit(u32 destination, bool bl, u32 after);
   void WriteExitDestInRSCRATCH(bool bl = false, u32 after = 0);
+  // Like WriteExitDestInRSCRATCH, but for indirect branches whose targets tend to repeat.
+  void WriteIndirectExitDestInRSCRATCH(bool bl = false, u32 after = 0);
   void WriteBLRExit();
   void WriteExceptionExit();
   void WriteExternalExceptionExit();
   void WriteRfiExitDestInRSCRATCH();
   void WriteIdleExit(u32 destination);
+  // Counts side exits of forward conditional branches so that hot ones get followed.
+  void WriteBranchExitCounter(const PPCAnalyst::CodeOp& op);
   template <bool condition>
   void WriteBranchWatch(u32 origin, u32 destination, UGeckoInstruction inst, Gen::X64Reg reg_a,
                         Gen::X64Reg reg_b, BitSet32 caller_save);
@@ -275,10 +281,14 @@ private:
 
   void FreeRanges();
   void ResetFreeMemoryRanges();
+  void EvictBlocksIfLowOnCodeSpace();
 
   void LogGeneratedCode() const;
 
   static void ImHere(Jit64& jit);
+  static void UpdateIndirectBranchCache(Jit64& jit, u8* exit_ptr, u32 block_start);
+  template <bool followed>
+  static void OnFrequentBranchExit(Jit64& jit, u32 branch_address);
 
   JitBlockCache blocks{*this};
   TrampolineCache trampolines{*this};
@@ -291,6 +301,14 @@ private:
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_far;
 
+  // Forward conditional branches that the analyzer follows into their target, and branches that
+  // were followed before but turned out to fall through too often to be worth it.
+  static constexpr u32 BRANCH_EXIT_COUNTERS = 0x4000;
+  static constexpr u32 BRANCH_EXIT_THRESHOLD = 1024;
+  std::array<u32, BRANCH_EXIT_COUNTERS> m_branch_exit_counters{};
+  std::unordered_set<u32> m_hot_branches;
+  std::unordered_set<u32> m_cold_branches;
+
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
   std::map<u32, int> m_been_here;
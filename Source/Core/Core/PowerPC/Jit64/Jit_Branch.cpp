@@ -191,6 +191,24 @@ void Jit64::bcx(UGeckoInstruction inst)
 
   // USES_CR
 
+  if (js.op->branchFollowed)
+  {
+    // The analyzer continued at the branch target, so it's the fall-through path that leaves the
+    // block here. Everything cached in registers stays valid along the followed path.
+    FixupBranch pConditionBranch =
+        JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), (inst.BO_2 & BO_BRANCH_IF_TRUE) != 0);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteBranchExitCounter(*js.op);
+      WriteExit(js.compilerPC + 4);
+    }
+    SetJumpTarget(pConditionBranch);
+    return;
+  }
+
   FixupBranch pCTRDontBranch;
   if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)  // Decrement and test CTR
   {
@@ -249,6 +267,7 @@ void Jit64::bcx(UGeckoInstruction inst)
     }
     else
     {
+      WriteBranchExitCounter(*js.op);
       WriteExit(js.op->branchTo, inst.LK, js.compilerPC + 4);
     }
   }
@@ -303,7 +322,7 @@ void Jit64::bcctrx(UGeckoInstruction inst)
       WriteBranchWatchDestInRSCRATCH(js.compilerPC, inst, ABI_PARAM1, RSCRATCH2,
                                      BitSet32{RSCRATCH});
     }
-    WriteExitDestInRSCRATCH(inst.LK_3, js.compilerPC + 4);
+    WriteIndirectExitDestInRSCRATCH(inst.LK_3, js.compilerPC + 4);
   }
   else
   {
@@ -316,7 +335,7 @@ void Jit64::bcctrx(UGeckoInstruction inst)
         JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
     MOV(32, R(RSCRATCH), PPCSTATE_CTR);
     AND(32, R(RSCRATCH), Imm32(0xFFFFFFFC));
-    // MOV(32, PPCSTATE(pc), R(RSCRATCH)); => Already done in WriteExitDestInRSCRATCH()
+    // MOV(32, PPCSTATE(pc), R(RSCRATCH)); => Already done in WriteIndirectExitDestInRSCRATCH()
     if (inst.LK_3)
       MOV(32, PPCSTATE_LR, Imm32(js.compilerPC + 4));  // LR = PC + 4;
 
@@ -331,7 +350,7 @@ void Jit64::bcctrx(UGeckoInstruction inst)
         WriteBranchWatchDestInRSCRATCH(js.compilerPC, inst, ABI_PARAM1, RSCRATCH2,
                                        BitSet32{RSCRATCH});
       }
-      WriteExitDestInRSCRATCH(inst.LK_3, js.compilerPC + 4);
+      WriteIndirectExitDestInRSCRATCH(inst.LK_3, js.compilerPC + 4);
       // Would really like to continue the block here, but it ends. TODO.
     }
     SetJumpTarget(b);
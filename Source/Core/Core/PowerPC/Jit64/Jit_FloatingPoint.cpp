@@ -510,12 +510,13 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       if (round_input)
         Force25BitPrecision(result_xmm, R(result_xmm), scratch_xmm);
     }
-    else
+    else if (round_input)
     {
-      if (round_input)
-        Force25BitPrecision(result_xmm, Rc, scratch_xmm);
-      else
-        MOVAPD(result_xmm, Rc);
+      Force25BitPrecision(result_xmm, Rc, scratch_xmm);
+    }
+    else if (use_fma)
+    {
+      MOVAPD(result_xmm, Rc);
     }
 
     if (use_fma)
@@ -537,9 +538,12 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
     }
     else
     {
+      // Without FMA, the multiplication doesn't have to overwrite its input, so with AVX the
+      // unmodified Rc can be used directly instead of being copied into result_xmm first.
+      const OpArg product_input = madds0 || madds1 || round_input ? R(result_xmm) : Rc;
       if (packed)
       {
-        MULPD(result_xmm, Ra);
+        avx_op(&XEmitter::VMULPD, &XEmitter::MULPD, result_xmm, product_input, Ra);
         if (subtract)
           SUBPD(result_xmm, Rb);
         else
@@ -547,7 +551,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
       }
       else
       {
-        MULSD(result_xmm, Ra);
+        avx_op(&XEmitter::VMULSD, &XEmitter::MULSD, result_xmm, product_input, Ra, false);
         if (subtract)
           SUBSD(result_xmm, Rb);
         else
@@ -376,6 +376,10 @@ bool Jit64::CheckMergedBranch(u32 crf) const
   if (!CanMergeNextInstructions(1))
     return false;
 
+  // Followed branches leave the block on the fall-through path, which merging doesn't handle.
+  if (js.op[1].branchFollowed)
+    return false;
+
   const UGeckoInstruction& next = js.op[1].inst;
   return (((next.OPCD == 16 /* bcx */) ||
            ((next.OPCD == 19) && (next.SUBOP10 == 528) /* bcctrx */) ||
@@ -414,6 +418,7 @@ void Jit64::DoMergedBranch()
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatch<true>(nextPC, destination, next, ABI_PARAM1, RSCRATCH, {});
     }
+    WriteBranchExitCounter(js.op[1]);
     WriteExit(destination, next.LK, nextPC + 4);
   }
   else if ((next.OPCD == 19) && (next.SUBOP10 == 528))  // bcctrx
@@ -427,7 +432,7 @@ void Jit64::DoMergedBranch()
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatchDestInRSCRATCH(nextPC, next, ABI_PARAM1, RSCRATCH2, BitSet32{RSCRATCH});
     }
-    WriteExitDestInRSCRATCH(next.LK, nextPC + 4);
+    WriteIndirectExitDestInRSCRATCH(next.LK, nextPC + 4);
   }
   else if ((next.OPCD == 19) && (next.SUBOP10 == 16))  // bclrx
   {
@@ -18,9 +18,11 @@
 #include "Common/HostDisassembler.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -66,6 +68,8 @@ void JitArm64::Init()
   // AddChildCodeSpace grabs space from the end of the parent region,
   // so we have to call AddChildCodeSpace in reverse order.
   AllocCodeSpace(TOTAL_CODE_SIZE);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    Common::AdviseHugePages(region, region_size);
   AddChildCodeSpace(&m_far_code_1, FAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_1, NEAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_0, NEAR_CODE_SIZE);
@@ -150,6 +154,11 @@ bool JitArm64::HandleFault(uintptr_t access_address, SContext* ctx)
                       fmt::ptr(m_ppc_state.mem_ptr), fmt::ptr(memory.GetPhysicalBase()),
                       fmt::ptr(memory.GetLogicalBase()));
       }
+      else if (m_mmu.AddPageTableFastmemMapping(static_cast<u32>(access_address - memory_base)))
+      {
+        // The page is accessible now, so let the access run again.
+        success = true;
+      }
       else
       {
         success = HandleFastmemFault(ctx);
@@ -478,7 +487,7 @@ void JitArm64::WriteExit(u32 destination, bool LK, u32 exit_address_after_return
   Cleanup();
   if (IsProfilingEnabled())
   {
-    ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+    ABI_CallFunction(GetProfilingEndFunction(), js.curBlock->profile_data.get(),
                      js.downcountAmount);
   }
   DoDownCount();
@@ -583,7 +592,7 @@ void JitArm64::WriteExit(Arm64Gen::ARM64Reg dest, bool LK, u32 exit_address_afte
   Cleanup();
   if (IsProfilingEnabled())
   {
-    ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+    ABI_CallFunction(GetProfilingEndFunction(), js.curBlock->profile_data.get(),
                      js.downcountAmount);
   }
   DoDownCount();
@@ -752,7 +761,7 @@ void JitArm64::WriteBLRExit(Arm64Gen::ARM64Reg dest)
   Cleanup();
   if (IsProfilingEnabled())
   {
-    ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+    ABI_CallFunction(GetProfilingEndFunction(), js.curBlock->profile_data.get(),
                      js.downcountAmount);
   }
 
@@ -820,7 +829,7 @@ void JitArm64::WriteExceptionExit(ARM64Reg dest, bool only_external, bool always
 
   if (IsProfilingEnabled())
   {
-    ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, js.curBlock->profile_data.get(),
+    ABI_CallFunction(GetProfilingEndFunction(), js.curBlock->profile_data.get(),
                      js.downcountAmount);
   }
   DoDownCount();
@@ -1140,7 +1149,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   // Conditionally add profiling code.
   if (IsProfilingEnabled())
-    ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
+    ABI_CallFunction(GetProfilingBeginFunction(), b->profile_data.get());
 
   if (code_block.m_gqr_used.Count() == 1 && !js.pairedQuantizeAddresses.contains(js.blockStart))
   {
@@ -1294,8 +1303,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         Cleanup();
         if (IsProfilingEnabled())
         {
-          ABI_CallFunction(&JitBlock::ProfileData::EndProfiling, b->profile_data.get(),
-                           js.downcountAmount);
+          ABI_CallFunction(GetProfilingEndFunction(), b->profile_data.get(), js.downcountAmount);
         }
         DoDownCount();
         B(dispatcher_exit);
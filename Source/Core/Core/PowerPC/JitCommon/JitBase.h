@@ -151,6 +151,7 @@ protected:
   bool bJITBranchOff = false;
   bool bJITRegisterCacheOff = false;
   bool m_enable_profiling = false;
+  bool m_enable_profiling_timing = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
@@ -165,7 +166,7 @@ protected:
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 24> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -198,6 +199,18 @@ public:
   ~JitBase() override;
 
   bool IsProfilingEnabled() const { return m_enable_profiling; }
+  // If false, profiled blocks only count their runs and cycles, not the time spent in them.
+  bool IsProfilingTimingEnabled() const { return m_enable_profiling_timing; }
+  auto GetProfilingBeginFunction() const
+  {
+    return m_enable_profiling_timing ? &JitBlock::ProfileData::BeginProfiling :
+                                       &JitBlock::ProfileData::BeginCounting;
+  }
+  auto GetProfilingEndFunction() const
+  {
+    return m_enable_profiling_timing ? &JitBlock::ProfileData::EndProfiling :
+                                       &JitBlock::ProfileData::EndCounting;
+  }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
 
   static const u8* Dispatch(JitBase& jit);
@@ -12,6 +12,7 @@
 #include <set>
 #include <span>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
@@ -47,6 +48,16 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+void JitBlock::ProfileData::BeginCounting(ProfileData* data)
+{
+  data->run_count += 1;
+}
+
+void JitBlock::ProfileData::EndCounting(ProfileData* data, u32 downcount_amount)
+{
+  data->cycles_spent += downcount_amount;
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -139,6 +150,7 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.generation = m_next_generation++;
   return &b;
 }
 
@@ -411,6 +423,47 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
 }
 
+void JitBaseBlockCache::EvictOldestBlocks(std::size_t count)
+{
+  std::vector<const JitBlock*> blocks;
+  blocks.reserve(block_map.size());
+  for (const auto& [physical_address, block] : block_map)
+    blocks.push_back(&block);
+
+  count = std::min(count, blocks.size());
+  std::ranges::nth_element(blocks, blocks.begin() + count, {}, &JitBlock::generation);
+  for (const JitBlock* block : std::span(blocks).first(count))
+    EraseSingleBlock(*block);
+}
+
+void JitBaseBlockCache::RelinkExit(JitBlock& block, std::size_t link_index, u32 exit_address)
+{
+  JitBlock::LinkData& link = block.linkData[link_index];
+  const u32 old_exit_address = link.exitAddress;
+  if (link.linkStatus)
+  {
+    WriteLinkBlock(link, nullptr);
+    link.linkStatus = false;
+  }
+  link.exitAddress = exit_address;
+
+  if (std::ranges::none_of(block.linkData, [old_exit_address](const JitBlock::LinkData& e) {
+        return e.exitAddress == old_exit_address;
+      }))
+  {
+    const auto it = links_to.find(old_exit_address);
+    if (it != links_to.end())
+    {
+      it->second.erase(&block);
+      if (it->second.empty())
+        links_to.erase(it);
+    }
+  }
+  links_to[exit_address].insert(&block);
+
+  LinkBlockExits(block);
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -437,6 +490,9 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
       {
         WriteLinkBlock(e, destinationBlock);
         e.linkStatus = true;
+        // Both ends of a new link are likely to run soon, so keep them from being evicted.
+        block.generation = m_next_generation++;
+        destinationBlock->generation = m_next_generation++;
       }
     }
   }
@@ -553,6 +609,7 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, CPUEmuFeatureFlags
     m_fast_block_map_fallback[index] = block;
   }
   block->fast_block_map_index = index;
+  block->generation = m_next_generation++;
 
   return block;
 }
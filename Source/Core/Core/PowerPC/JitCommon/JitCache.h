@@ -70,6 +70,9 @@ struct JitBlock : public JitBlockData
 
     static void BeginProfiling(ProfileData* data);
     static void EndProfiling(ProfileData* data, u32 downcount_amount);
+    // Like the above, but without measuring time.
+    static void BeginCounting(ProfileData* data);
+    static void EndCounting(ProfileData* data, u32 downcount_amount);
 
     std::size_t run_count = 0;
     u64 cycles_spent = 0;
@@ -108,6 +111,10 @@ struct JitBlock : public JitBlockData
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Taken from a counter when the block is compiled, linked or looked up by the dispatcher.
+  // Blocks with the lowest generation are evicted first when the code space runs low.
+  u64 generation = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -185,6 +192,14 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
   void EraseSingleBlock(const JitBlock& block);
+  // Erases the given number of blocks, starting with the ones that were least recently compiled,
+  // linked or looked up. Running through existing links or the fast lookup table doesn't count as
+  // a use, so this only approximates LRU. Blocks which are still in use will simply be compiled
+  // again.
+  void EvictOldestBlocks(std::size_t count);
+  // Points an exit of the block at a different guest address and links it if a block for that
+  // address exists. Used by inline caches for indirect branches.
+  void RelinkExit(JitBlock& block, std::size_t link_index, u32 exit_address);
 
   u32* GetBlockBitSet() const;
 
@@ -235,4 +250,6 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  u64 m_next_generation = 0;
 };
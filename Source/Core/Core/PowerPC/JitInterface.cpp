@@ -4,16 +4,26 @@
 #include "Core/PowerPC/JitInterface.h"
 
 #include <algorithm>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/SymbolDB.h"
 
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
@@ -182,6 +192,144 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   }
 }
 
+namespace
+{
+struct FunctionProfile
+{
+  // nullptr for the blocks which aren't part of any known function.
+  const Common::Symbol* symbol = nullptr;
+  u64 run_count = 0;
+  u64 cycles_spent = 0;
+  JitBlock::ProfileData::Clock::duration time_spent = {};
+  std::vector<const JitBlock*> blocks;
+};
+
+std::vector<FunctionProfile> GetFunctionProfiles(const Core::CPUThreadGuard& guard, JitBase& jit)
+{
+  std::unordered_map<const Common::Symbol*, FunctionProfile> functions;
+  jit.GetBlockCache()->RunOnBlocks(guard, [&](const JitBlock& block) {
+    const JitBlock::ProfileData* const data = block.profile_data.get();
+    if (data == nullptr || data->run_count == 0)
+      return;
+
+    const Common::Symbol* const symbol =
+        jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress);
+    FunctionProfile& function = functions[symbol];
+    function.symbol = symbol;
+    function.run_count += data->run_count;
+    function.cycles_spent += data->cycles_spent;
+    function.time_spent += data->time_spent;
+    function.blocks.push_back(&block);
+  });
+
+  std::vector<FunctionProfile> result;
+  result.reserve(functions.size());
+  for (auto& [symbol, function] : functions)
+  {
+    std::ranges::sort(function.blocks, std::ranges::greater{},
+                      [](const JitBlock* block) { return block->profile_data->cycles_spent; });
+    result.push_back(std::move(function));
+  }
+  std::ranges::sort(result, [](const FunctionProfile& a, const FunctionProfile& b) {
+    return std::tie(a.cycles_spent, a.run_count) > std::tie(b.cycles_spent, b.run_count);
+  });
+  return result;
+}
+
+// Frames in the folded stack format are separated by semicolons, and lines end with the count.
+std::string GetFoldedStackFrame(std::string_view name)
+{
+  std::string frame(name);
+  std::ranges::replace(frame, ';', ':');
+  std::ranges::replace(frame, '\n', ' ');
+  return frame;
+}
+}  // namespace
+
+void JitInterface::JitProfileReport(const Core::CPUThreadGuard& guard, std::FILE* file) const
+{
+  std::fputs("symbol\tppcAddress\tblocks\trunCount\tcyclesSpent\tcyclesPercent\ttimeSpent(ns)"
+             "\ttimePercent\n",
+             file);
+
+  if (!m_jit || !m_jit->IsProfilingEnabled())
+    return;
+
+  const std::vector<FunctionProfile> functions = GetFunctionProfiles(guard, *m_jit);
+  u64 overall_cycles_spent = 0;
+  JitBlock::ProfileData::Clock::duration overall_time_spent = {};
+  for (const FunctionProfile& function : functions)
+  {
+    overall_cycles_spent += function.cycles_spent;
+    overall_time_spent += function.time_spent;
+  }
+
+  for (const FunctionProfile& function : functions)
+  {
+    const double cycles_percent =
+        overall_cycles_spent == 0 ? double{} : 100.0 * function.cycles_spent / overall_cycles_spent;
+    const double time_percent =
+        overall_time_spent == JitBlock::ProfileData::Clock::duration{} ?
+            double{} :
+            100.0 * function.time_spent.count() / overall_time_spent.count();
+    const std::string address =
+        function.symbol ? fmt::format("{:08x}", function.symbol->address) : "-";
+
+    fmt::println(file, "\"{}\"\t{}\t{}\t{}\t{}\t{:.6f}\t{}\t{:.6f}",
+                 function.symbol ? std::string_view{function.symbol->name} : "", address,
+                 function.blocks.size(), function.run_count, function.cycles_spent, cycles_percent,
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(function.time_spent).count(),
+                 time_percent);
+  }
+}
+
+void JitInterface::JitProfileFoldedStacks(const Core::CPUThreadGuard& guard,
+                                          std::FILE* file) const
+{
+  if (!m_jit || !m_jit->IsProfilingEnabled())
+    return;
+
+  // Stacks are object file (if known), function, and block, weighted by the cycles spent.
+  for (const FunctionProfile& function : GetFunctionProfiles(guard, *m_jit))
+  {
+    std::string prefix;
+    if (function.symbol == nullptr)
+      prefix = "[unknown]";
+    else if (function.symbol->object_name.empty())
+      prefix = GetFoldedStackFrame(function.symbol->name);
+    else
+      prefix = fmt::format("{};{}", GetFoldedStackFrame(function.symbol->object_name),
+                           GetFoldedStackFrame(function.symbol->name));
+
+    for (const JitBlock* block : function.blocks)
+    {
+      if (block->profile_data->cycles_spent != 0)
+      {
+        fmt::println(file, "{};block_{:08x} {}", prefix, block->effectiveAddress,
+                     block->profile_data->cycles_spent);
+      }
+    }
+  }
+}
+
+std::optional<std::string> JitInterface::WriteJitProfile(const Core::CPUThreadGuard& guard) const
+{
+  const std::string path = fmt::format("{}{}_profile", File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                                       SConfig::GetInstance().GetGameID());
+  File::CreateFullPath(path);
+  File::IOFile report(path + ".txt", "w");
+  File::IOFile folded_stacks(path + ".folded", "w");
+  if (!report || !folded_stacks)
+  {
+    ERROR_LOG_FMT(POWERPC, "Failed to open {}.txt or {}.folded for writing", path, path);
+    return std::nullopt;
+  }
+
+  JitProfileReport(guard, report.GetHandle());
+  JitProfileFoldedStacks(guard, folded_stacks.GetHandle());
+  return path;
+}
+
 void JitInterface::WipeBlockProfilingData(const Core::CPUThreadGuard& guard)
 {
   if (m_jit)
@@ -351,6 +499,12 @@ void JitInterface::Shutdown()
 {
   if (m_jit)
   {
+    if (m_jit->IsProfilingEnabled() && Config::Get(Config::MAIN_DEBUG_JIT_PROFILE_DUMP_ON_EXIT))
+    {
+      if (const std::optional<std::string> path = WriteJitProfile(Core::CPUThreadGuard{m_system}))
+        NOTICE_LOG_FMT(POWERPC, "Wrote JIT profile to {}.txt and {}.folded", *path, *path);
+    }
+
     m_jit->Shutdown();
     m_jit.reset();
   }
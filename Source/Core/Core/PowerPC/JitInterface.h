@@ -8,6 +8,8 @@
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -47,6 +49,12 @@ public:
 
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  // Write the block profiling data attributed to the functions in the symbol map, as a table sorted
+  // by cycles spent, and in the folded stack format used by flame graph tools.
+  void JitProfileReport(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  void JitProfileFoldedStacks(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  // Write both of the above to the JitBlock dump directory. Returns the path without extension.
+  std::optional<std::string> WriteJitProfile(const Core::CPUThreadGuard& guard) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   std::size_t GetBlockCount() const;
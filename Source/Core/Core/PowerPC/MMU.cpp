@@ -174,6 +174,16 @@ T MMU::ReadFromHardware(u32 em_address)
   if (!never_translate &&
       (IsOpcodeFlag(flag) ? m_ppc_state.msr.IR.Value() : m_ppc_state.msr.DR.Value()))
   {
+    if constexpr (flag == XCheckTLBFlag::Read)
+    {
+      if (const u8* const host_address = LookupSoftwareTLB(em_address, false))
+      {
+        T value;
+        std::memcpy(&value, host_address, sizeof(T));
+        return bswap(value);
+      }
+    }
+
     auto translated_addr = TranslateAddress<flag>(em_address);
     if (!translated_addr.Success())
     {
@@ -181,6 +191,11 @@ T MMU::ReadFromHardware(u32 em_address)
         GenerateDSIException(em_address, false);
       return 0;
     }
+    if constexpr (flag == XCheckTLBFlag::Read)
+    {
+      if (translated_addr.result == TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED)
+        FillSoftwareTLB(em_address, translated_addr.address);
+    }
     em_address = translated_addr.address;
     wi = translated_addr.wi;
   }
@@ -292,6 +307,16 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
 
   if (!never_translate && m_ppc_state.msr.DR)
   {
+    if constexpr (flag == XCheckTLBFlag::Write)
+    {
+      if (u8* const host_address = LookupSoftwareTLB(em_address, true))
+      {
+        const u32 swapped_data = Common::swap32(std::rotr(data, size * 8));
+        std::memcpy(host_address, &swapped_data, size);
+        return;
+      }
+    }
+
     auto translated_addr = TranslateAddress<flag>(em_address);
     if (!translated_addr.Success())
     {
@@ -299,6 +324,11 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
         GenerateDSIException(em_address, true);
       return;
     }
+    if constexpr (flag == XCheckTLBFlag::Write)
+    {
+      if (translated_addr.result == TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED)
+        FillSoftwareTLB(em_address, translated_addr.address);
+    }
     em_address = translated_addr.address;
     wi = translated_addr.wi;
   }
@@ -1324,6 +1354,79 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  m_memory.RemoveAllPageTableMappings();
+  InvalidateSoftwareTLB();
+}
+
+void MMU::SRUpdated(u32 index)
+{
+  // Segment registers aren't cached in the TLB, but they are baked into the fastmem mappings and
+  // the software TLB.
+  m_memory.RemovePageTableMappingsInSegment(index);
+  InvalidateSoftwareTLB();
+}
+
+u8* MMU::LookupSoftwareTLB(u32 address, bool write)
+{
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const SoftwareTLBEntry& entry = m_software_tlb[tag % SOFTWARE_TLB_SIZE];
+  if (entry.tag != tag || (write && !entry.writable))
+    return nullptr;
+
+  // Update the replacement state of the emulated TLB just like a hit in it would.
+  m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK].recent = entry.way;
+  return entry.host_page + (address & HW_PAGE_MASK);
+}
+
+void MMU::FillSoftwareTLB(u32 address, u32 physical_address)
+{
+  if (m_ppc_state.m_enable_dcache)
+    return;
+
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const u32 vsid = UReg_SR{m_ppc_state.sr[EffectiveAddress{address}.SR]}.VSID;
+  const TLBEntry& tlbe = m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK];
+  u32 way = 0;
+  while (tlbe.tag[way] != tag || tlbe.vsid[way] != vsid)
+  {
+    if (++way == PowerPC::TLB_WAYS)
+      return;
+  }
+
+  const UPTE_Hi pte2(tlbe.pte[way]);
+  if ((pte2.WIMG & 0b1100) != 0)
+    return;
+
+  const u32 physical_page = physical_address & ~static_cast<u32>(HW_PAGE_MASK);
+  u8* host_page;
+  if (m_memory.GetRAM() && (physical_page & 0xF8000000) == 0x00000000)
+  {
+    host_page = m_memory.GetRAM() + (physical_page & m_memory.GetRamMask());
+  }
+  else if (m_memory.GetEXRAM() && (physical_page >> 28) == 0x1 &&
+           (physical_page & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+  {
+    host_page = m_memory.GetEXRAM() + (physical_page & 0x0FFFFFFF);
+  }
+  else
+  {
+    return;
+  }
+
+  m_software_tlb[tag % SOFTWARE_TLB_SIZE] = {
+      .tag = tag, .host_page = host_page, .way = static_cast<u8>(way), .writable = pte2.C != 0};
+}
+
+void MMU::InvalidateSoftwareTLBSet(u32 set)
+{
+  for (u32 i = set; i < SOFTWARE_TLB_SIZE; i += HW_PAGE_INDEX_MASK + 1)
+    m_software_tlb[i] = {};
+}
+
+void MMU::InvalidateSoftwareTLB()
+{
+  m_software_tlb.fill({});
 }
 
 enum class TLBLookupResult
@@ -1413,6 +1516,38 @@ void MMU::InvalidateTLBEntry(u32 address)
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+  m_memory.RemovePageTableMappings(entry_index);
+  InvalidateSoftwareTLBSet(entry_index);
+}
+
+bool MMU::AddPageTableFastmemMapping(u32 address)
+{
+  if (!m_ppc_state.msr.DR)
+    return false;
+
+  // BAT translations take priority over the page table, and are already mapped where possible.
+  if (m_dbat_table[address >> BAT_INDEX_SHIFT] & BAT_MAPPED_BIT)
+    return false;
+
+  const u32 page_address = address & ~static_cast<u32>(HW_PAGE_MASK);
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+    return false;
+
+  bool wi = false;
+  const TranslateAddressResult result =
+      TranslatePageAddress<XCheckTLBFlag::NoException>(EffectiveAddress{page_address}, &wi);
+  if (result.result != TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED || wi ||
+      !CanMapInFastmem(result.address))
+  {
+    return false;
+  }
+
+  // Fast accesses don't update the R and C bits of the PTE, so set both now like a store would.
+  // Pages which are only read get reported as changed, which at worst makes the guest OS write
+  // them back to its backing store unnecessarily.
+  TranslatePageAddress<XCheckTLBFlag::Write>(EffectiveAddress{page_address}, &wi);
+
+  return m_memory.AddPageTableMapping(page_address, result.address);
 }
 
 // Page Address Translation
@@ -1503,7 +1638,12 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
 
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
+        {
           UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+          // The entry that got replaced may be cached in the software TLB.
+          if (!IsOpcodeFlag(flag))
+            InvalidateSoftwareTLBSet((address.Hex >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK);
+        }
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
@@ -1515,6 +1655,20 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
 }
 
+bool MMU::CanMapInFastmem(u32 physical_address) const
+{
+  if (m_memory.GetFakeVMEM() && (physical_address & 0xFE000000) == 0x7E000000)
+    return true;
+  if (physical_address < m_memory.GetRamSizeReal())
+    return true;
+  if (m_memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
+      (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+  {
+    return true;
+  }
+  return physical_address >> 28 == 0xE && physical_address < 0xE0000000 + m_memory.GetL1CacheSize();
+}
+
 void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
 {
   // TODO: Separate BATs for MSR.PR==0 and MSR.PR==1
@@ -1574,27 +1728,8 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
         // Enable fastmem mappings for cached memory. There are quirks related to uncached memory
         // that can't be correctly emulated by fast accesses, so we don't map uncached memory.
         // (No normal games are known to rely on the quirks, though.)
-        if (!wi)
-        {
-          if (m_memory.GetFakeVMEM() && (physical_address & 0xFE000000) == 0x7E000000)
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (physical_address < m_memory.GetRamSizeReal())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (m_memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
-                   (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (physical_address >> 28 == 0xE &&
-                   physical_address < 0xE0000000 + m_memory.GetL1CacheSize())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-        }
+        if (!wi && CanMapInFastmem(physical_address))
+          valid_bit |= BAT_PHYSICAL_BIT;
 
         // Fast accesses don't support memchecks, so force slow accesses by removing fastmem
         // mappings for all overlapping virtual pages.
@@ -1628,6 +1763,7 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
 void MMU::DBATUpdated()
 {
   m_dbat_table = {};
+  InvalidateSoftwareTLB();
   UpdateBATs(m_dbat_table, SPR_DBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
   if (extended_bats)
@@ -238,10 +238,16 @@ public:
 
   // TLB functions
   void SDRUpdated();
+  void SRUpdated(u32 index);
   void InvalidateTLBEntry(u32 address);
   void DBATUpdated();
   void IBATUpdated();
 
+  // Called by the JIT when a fastmem access faults. If the address is translated through the page
+  // table to RAM, maps the page into the logical fastmem view and returns true, in which case the
+  // access can simply be retried.
+  bool AddPageTableFastmemMapping(u32 address);
+
   // Result changes based on the BAT registers and MSR.DR.  Returns whether
   // it's safe to optimize a read or write to this address to an unguarded
   // memory access.  Does not consider page tables.
@@ -256,6 +262,10 @@ public:
   BatTable& GetIBATTable() { return m_ibat_table; }
   BatTable& GetDBATTable() { return m_dbat_table; }
 
+  // Drops all cached page translations, e.g. when the data cache starts being emulated and
+  // accesses can no longer bypass it.
+  void InvalidateSoftwareTLB();
+
 private:
   enum class TranslateAddressResultEnum : u8
   {
@@ -297,11 +307,34 @@ private:
   template <const XCheckTLBFlag flag>
   TranslateAddressResult TranslatePageAddress(const EffectiveAddress address, bool* wi);
 
+  // Direct-mapped cache in front of the data TLB for the slow paths, mapping effective pages that
+  // are translated through the page table straight to host memory. This lets accesses skip the BAT
+  // lookup, the TLB lookup and the dispatch on the physical memory region. Entries only exist while
+  // the corresponding TLB entry does, and only for RAM that is neither write-through nor
+  // cache-inhibited when the data cache isn't emulated.
+  struct SoftwareTLBEntry
+  {
+    static constexpr u32 INVALID_TAG = 0xffffffff;
+
+    u32 tag = INVALID_TAG;
+    u8* host_page = nullptr;
+    u8 way = 0;
+    // Whether the C bit of the PTE is already set, so that stores don't need to update it.
+    bool writable = false;
+  };
+  // Two entries for each set of the emulated TLB.
+  static constexpr u32 SOFTWARE_TLB_SIZE = 2 * (HW_PAGE_INDEX_MASK + 1);
+
+  u8* LookupSoftwareTLB(u32 address, bool write);
+  void FillSoftwareTLB(u32 address, u32 physical_address);
+  void InvalidateSoftwareTLBSet(u32 set);
+
   void GenerateDSIException(u32 effective_address, bool write);
   void GenerateISIException(u32 effective_address);
 
   void Memcheck(u32 address, u64 var, bool write, size_t size);
 
+  bool CanMapInFastmem(u32 physical_address) const;
   void UpdateBATs(BatTable& bat_table, u32 base_spr);
   void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr);
 
@@ -326,6 +359,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  std::array<SoftwareTLBEntry, SOFTWARE_TLB_SIZE> m_software_tlb;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
@@ -737,20 +737,52 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+// Whether executing an instruction over and over has no effect beyond the first time, apart from
+// the registers it writes, which IsBusyWaitLoop tracks separately.
+static bool CanBeInBusyWaitLoop(const CodeOp& op)
+{
+  switch (op.opinfo->type)
+  {
+  case OpType::Integer:
+  case OpType::Load:
+  case OpType::CR:
+    return true;
+  case OpType::DataCache:
+    // Everything except dcba and dcbz, which zero memory. Polling memory written by DMA usually
+    // involves invalidating the cache line first.
+    return op.inst.SUBOP10 != 758 && op.inst.SUBOP10 != 1014;
+  case OpType::InstructionCache:
+    // isync
+    return true;
+  case OpType::System:
+    // mcrf, sync and eieio
+    return (op.inst.OPCD == 19 && op.inst.SUBOP10 == 0) ||
+           (op.inst.OPCD == 31 && (op.inst.SUBOP10 == 598 || op.inst.SUBOP10 == 854));
+  default:
+    return false;
+  }
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
-  //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //   * It does not write to memory or otherwise change state when executed repeatedly.
+  //   * It only reads from registers (GPRs, CR fields and CA) it wrote to earlier in the loop, or
+  //     it does not write to these registers.
+  //
+  // Such a loop can only be exited by an interrupt or by hardware changing what it reads, both of
+  // which only happen as the result of a CoreTiming event. Skipping ahead to the next event thus
+  // gives the exact same result, which keeps idle skipping deterministic for movies and netplay.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // Calls to leaf functions are covered as long as the branch follower inlines them. Functions
+  // which set up a stack frame store to memory, so they are still rejected.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  BitSet8 write_disallowed_cr;
+  BitSet8 written_cr;
+  bool write_disallowed_ca = false;
+  bool written_ca = false;
   for (size_t i = 0; i <= instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
@@ -760,11 +792,8 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (!CanBeInBusyWaitLoop(code[i]))
     {
-      // In the future, some subsets of other instruction types might get
-      // supported. Right now, only try loops that have this very
-      // restricted instruction set.
       return false;
     }
     else
@@ -785,6 +814,20 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
           return false;
         written_regs[reg] = true;
       }
+
+      write_disallowed_cr |= code[i].crIn & ~written_cr;
+      if (code[i].crOut & write_disallowed_cr)
+        return false;
+      written_cr |= code[i].crOut;
+
+      if ((code[i].opinfo->flags & FL_READ_CA) && !written_ca)
+        write_disallowed_ca = true;
+      if (code[i].opinfo->flags & FL_SET_CA)
+      {
+        if (write_disallowed_ca)
+          return false;
+        written_ca = true;
+      }
     }
   }
   return false;
@@ -800,6 +843,16 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+bool CanFollowConditionalBranch(UGeckoInstruction inst)
+{
+  if (inst.OPCD != 16 || inst.LK || inst.AA || (inst.BO & BO_DONT_DECREMENT_FLAG) == 0 ||
+      (inst.BO & BO_DONT_CHECK_CONDITION) != 0)
+  {
+    return false;
+  }
+  return SignExt16(inst.BD << 2) > 0;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
                          std::size_t block_size) const
 {
@@ -887,6 +940,15 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
           caller = i;
         }
       }
+      else if (m_hot_branches && !m_is_debugging_enabled &&
+               HasOption(OPTION_CONDITIONAL_CONTINUE) && numFollows < BRANCH_FOLLOWING_THRESHOLD &&
+               CanFollowConditionalBranch(inst) && m_hot_branches->contains(address))
+      {
+        // Conditional branch which is known to be taken most of the time. Inline the target and
+        // leave the block when the branch isn't taken instead.
+        follow = true;
+        code[i].branchFollowed = true;
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
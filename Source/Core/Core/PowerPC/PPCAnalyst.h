@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -40,6 +41,8 @@ struct CodeOp  // 16B
   BitSet8 crOut;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // Conditional branch whose target was inlined into the block. Falling through exits the block.
+  bool branchFollowed = false;
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -181,6 +184,12 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // Conditional branches at these addresses are followed like unconditional ones, as long as they
+  // are eligible according to CanFollowConditionalBranch.
+  void SetHotBranches(const std::unordered_set<u32>* hot_branches)
+  {
+    m_hot_branches = hot_branches;
+  }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -205,8 +214,13 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+  const std::unordered_set<u32>* m_hot_branches = nullptr;
 };
 
+// Whether a conditional branch could have its target inlined into a block: it must not touch LR
+// or CTR, and it must jump forwards.
+bool CanFollowConditionalBranch(UGeckoInstruction inst);
+
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
                    PPCSymbolDB* func_db);
 bool AnalyzeFunction(const Core::CPUThreadGuard& guard, u32 startAddr, Common::Symbol& func,
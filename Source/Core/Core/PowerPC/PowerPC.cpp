@@ -254,6 +254,11 @@ void PowerPCManager::RefreshConfig()
     INFO_LOG_FMT(POWERPC, "Flushing data cache");
     m_ppc_state.dCache.FlushAll(m_system.GetMemory());
   }
+  else if (!old_enable_dcache && m_ppc_state.m_enable_dcache)
+  {
+    // The software TLB maps pages straight to RAM, which would bypass the data cache.
+    m_system.GetMMU().InvalidateSoftwareTLB();
+  }
 }
 
 void PowerPCManager::Init(CPUCore cpu_core)
@@ -134,6 +134,9 @@ enum
 
 static bool s_use_compression = true;
 
+// Only accessed on the CPU thread.
+static size_t s_last_state_size = 0;
+
 void EnableCompression(bool compression)
 {
   s_use_compression = compression;
@@ -229,23 +232,66 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
       true);
 }
 
-void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+// Writes the state into the buffer and resizes it to fit. Returns false if DoState aborted.
+//
+// With snapshot_ram, MEM1 and MEM2 are left to a copy-on-write snapshot when possible, so the
+// buffer isn't complete until Memory::MemoryManager::FinishRAMSnapshot has been called.
+//
+// The size of a state hardly changes from one save to the next, so the buffer is sized based on the
+// previous state instead of measuring it with a separate pass first. This matters because some
+// subsystems have to do real work to serialize themselves (e.g. walking the NAND). Should the state
+// have outgrown the buffer, PointerWrap falls back to measure mode, so the failed pass yields the
+// exact size for a second try.
+static bool DoStateToBuffer(Core::System& system, std::vector<u8>& buffer,
+                            bool snapshot_ram = false)
 {
-  Core::RunOnCPUThread(
-      system,
-      [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  size_t buffer_size = s_last_state_size + s_last_state_size / 16;
+  if (buffer_size == 0)
+  {
+    u8* ptr = nullptr;
+    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+    DoState(system, p_measure);
+    buffer_size = reinterpret_cast<size_t>(ptr);
+  }
+
+  auto& memory = system.GetMemory();
+  memory.SetRAMSnapshotRequested(snapshot_ram);
 
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+  bool success = false;
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+    buffer.resize(buffer_size);
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+    DoState(system, p);
 
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-      },
-      true);
+    const size_t state_size = static_cast<size_t>(ptr - buffer.data());
+    if (p.IsWriteMode())
+    {
+      // Shrinking doesn't reallocate, so a snapshot's destination stays valid.
+      buffer.resize(state_size);
+      s_last_state_size = state_size;
+      success = true;
+      break;
+    }
+
+    // The snapshot may have been started before the state ran out of space.
+    memory.FinishRAMSnapshot();
+
+    if (state_size <= buffer_size)
+      break;
+    buffer_size = state_size;
+  }
+
+  memory.SetRAMSnapshotRequested(false);
+  if (!success)
+    s_last_state_size = 0;
+  return success;
+}
+
+void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  Core::RunOnCPUThread(system, [&] { DoStateToBuffer(system, buffer); }, true);
 }
 
 namespace
@@ -385,6 +431,9 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
 
 static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
 {
+  // Emulation has kept running since the state was taken. Copy the rest of its RAM snapshot.
+  system.GetMemory().FinishRAMSnapshot();
+
   const u8* const buffer_data = save_args.buffer_vector.data();
   const size_t buffer_size = save_args.buffer_vector.size();
   const std::string& filename = save_args.filename;
@@ -483,20 +532,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
         std::vector<u8> current_buffer;
-        current_buffer.resize(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-
-        if (p.IsWriteMode())
+        if (DoStateToBuffer(system, current_buffer, true))
         {
           Core::DisplayMessage("Saving State...", 1000);
 
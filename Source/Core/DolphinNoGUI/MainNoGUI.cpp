@@ -19,6 +19,7 @@
 
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
+#include "Common/Tracer.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
 #include "Core/Core.h"
@@ -228,6 +229,11 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--trace")
+      .action("store")
+      .metavar("<file>")
+      .help("Write a trace of what all threads were doing to the given file, in the Chrome trace "
+            "format (viewable in Perfetto)");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -322,6 +328,13 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance().ReportDolphinStart("nogui");
 
+  std::string trace_path;
+  if (options.is_set("trace"))
+  {
+    trace_path = static_cast<const char*>(options.get("trace"));
+    Common::Tracer::Start();
+  }
+
   if (!BootManager::BootCore(Core::System::GetInstance(), std::move(boot), wsi))
   {
     fprintf(stderr, "Could not boot the specified file\n");
@@ -338,6 +351,9 @@ int main(int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (!trace_path.empty())
+    Common::Tracer::StopAndWrite(trace_path);
+
   return 0;
 }
 
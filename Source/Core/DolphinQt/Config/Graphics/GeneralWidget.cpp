@@ -150,6 +150,10 @@ void GeneralWidget::CreateWidgets()
   m_wait_for_shaders = new ConfigBool(tr("Compile Shaders Before Starting"),
                                       Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING, m_game_layer);
   shader_compilation_layout->addWidget(m_wait_for_shaders);
+  m_precompile_shared_pipelines =
+      new ConfigBool(tr("Precompile Shaders Used by Other Games"),
+                     Config::GFX_PRECOMPILE_SHARED_PIPELINES, m_game_layer);
+  shader_compilation_layout->addWidget(m_precompile_shared_pipelines);
   shader_compilation_box->setLayout(shader_compilation_layout);
 
   main_layout->addWidget(m_video_box);
@@ -319,6 +323,12 @@ void GeneralWidget::AddDescriptions()
                  "two or fewer cores, it is recommended to enable this option, as a large shader "
                  "queue may reduce frame rates.<br><br><dolphin_emphasis>Otherwise, if "
                  "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_PRECOMPILE_SHARED_PIPELINES_DESCRIPTION[] = QT_TR_NOOP(
+      "Compiles shaders that other games have used in the background when starting a game, "
+      "most widely used first. Many games share shaders, so this may reduce stuttering the first "
+      "time a game is played. Requires the shader cache, and takes extra CPU time and memory for "
+      "a short time after the game is started.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
 
   m_backend_combo->SetTitle(tr("Backend"));
   m_backend_combo->SetDescription(
@@ -354,6 +364,8 @@ void GeneralWidget::AddDescriptions()
   m_shader_compilation_mode[3]->SetDescription(tr(TR_SHADER_COMPILE_SKIP_DRAWING_DESCRIPTION));
 
   m_wait_for_shaders->SetDescription(tr(TR_SHADER_COMPILE_BEFORE_START_DESCRIPTION));
+
+  m_precompile_shared_pipelines->SetDescription(tr(TR_PRECOMPILE_SHARED_PIPELINES_DESCRIPTION));
 }
 
 void GeneralWidget::OnBackendChanged(const QString& backend_name)
@@ -65,6 +65,7 @@ private:
   ConfigBool* m_render_main_window;
   std::array<ConfigRadioInt*, 4> m_shader_compilation_mode{};
   ConfigBool* m_wait_for_shaders;
+  ConfigBool* m_precompile_shared_pipelines;
   int m_previous_backend = 0;
   Config::Layer* m_game_layer = nullptr;
 };
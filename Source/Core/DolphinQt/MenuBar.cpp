@@ -159,6 +159,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_search_instruction->setEnabled(running);
   m_jit_wipe_profiling_data->setEnabled(jit_exists);
   m_jit_write_cache_log_dump->setEnabled(jit_exists);
+  m_jit_write_profile->setEnabled(jit_exists);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -235,6 +236,21 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnWriteJitProfile()
+{
+  auto& system = Core::System::GetInstance();
+  const std::optional<std::string> path =
+      system.GetJitInterface().WriteJitProfile(Core::CPUThreadGuard{system});
+  if (!path)
+  {
+    ModalMessageBox::warning(this, tr("Error"), tr("Failed to write the JIT profile."));
+    return;
+  }
+  ModalMessageBox::information(
+      this, tr("Success"),
+      tr("Wrote to \"%1.txt\" and \"%1.folded\".").arg(QString::fromStdString(*path)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -942,6 +958,8 @@ void MenuBar::AddJITMenu()
                                                &MenuBar::OnWipeJitBlockProfilingData);
   m_jit_write_cache_log_dump =
       m_jit->addAction(tr("Write JIT Block Log Dump"), this, &MenuBar::OnWriteJitBlockLogDump);
+  m_jit_write_profile =
+      m_jit->addAction(tr("Write JIT Profile Report"), this, &MenuBar::OnWriteJitProfile);
 
   m_jit->addSeparator();
 
@@ -188,6 +188,7 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnWriteJitProfile();
 
   QString GetSignatureSelector() const;
 
@@ -274,6 +275,7 @@ private:
   QAction* m_jit_profile_blocks;
   QAction* m_jit_wipe_profiling_data;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_write_profile;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
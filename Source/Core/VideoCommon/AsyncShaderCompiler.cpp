@@ -8,6 +8,7 @@
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Tracer.h"
 
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -30,6 +31,7 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   // If no worker threads are available, compile synchronously.
   if (!HasWorkerThreads())
   {
+    Common::Tracer::ScopedEvent trace("Compile shader", "Shaders");
     item->Compile();
     m_completed_work.push_back(std::move(item));
   }
@@ -226,7 +228,12 @@ void AsyncShaderCompiler::WorkerThreadRun()
       m_pending_work.erase(iter);
       pending_lock.unlock();
 
-      if (item->Compile())
+      bool compiled;
+      {
+        Common::Tracer::ScopedEvent trace("Compile shader", "Shaders");
+        compiled = item->Compile();
+      }
+      if (compiled)
       {
         std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
         m_completed_work.push_back(std::move(item));
@@ -3,10 +3,17 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
+#include "Common/Event.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
@@ -54,10 +61,14 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__) && defined(__FMA__)
+static constexpr int MIN_SSE = 52;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -74,7 +85,9 @@ template <bool PositionHas3Elems, bool PerVertexPosMtx>
 static CPUCull::TransformFunction GetTransformFunction()
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  if (MIN_SSE >= 52 || (cpu_info.bAVX512F && cpu_info.bFMA))
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -98,15 +111,15 @@ static CPUCull::CullFunction GetCullFunction0()
   // Note: AVX version only actually AVX on compilers that support __attribute__((target))
   // Sorry, MSVC + Sandy Bridge.  (Ivy+ and AMD see very little benefit thanks to mov elimination)
   if (MIN_SSE >= 50 || cpu_info.bAVX)
-    return CPUCull_AVX::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_AVX::CullTriangles<Primitive, Mode>;
   else if (MIN_SSE >= 30 || cpu_info.bSSE3)
-    return CPUCull_SSE3::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE3::CullTriangles<Primitive, Mode>;
   else
-    return CPUCull_SSE::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE::CullTriangles<Primitive, Mode>;
 #elif defined(USE_NEON)
-  return CPUCull_NEON::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_NEON::CullTriangles<Primitive, Mode>;
 #else
-  return CPUCull_Scalar::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_Scalar::CullTriangles<Primitive, Mode>;
 #endif
 }
 
@@ -121,7 +134,44 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
-CPUCull::~CPUCull() = default;
+// Vertices are transformed and culled in chunks of this size, so that batches with visible
+// triangles near the start don't pay for transforming everything.  Being a multiple of 12 keeps
+// chunks on quad and triangle boundaries and the transformed vertices 64-byte aligned.
+static constexpr u32 CHUNK_SIZE = 12 * 32;
+// Batches with at least this many vertices are split between the worker threads
+static constexpr u32 PARALLEL_THRESHOLD = 4096;
+static constexpr int MAX_WORKERS = 3;
+
+struct CPUCull::Worker
+{
+  std::thread thread;
+  Common::Event start;
+  Common::Event done;
+  // Set to nullptr to make the worker exit
+  Slice* slice = nullptr;
+};
+
+// Number of triangles whose last vertex comes before vertex end
+static u32 CountTriangles(OpcodeDecoder::Primitive primitive, u32 end)
+{
+  switch (primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+    return end / 4 * 2 + (end % 4 == 3);
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    return end / 3;
+  default:
+    return end > 2 ? end - 2 : 0;
+  }
+}
+
+CPUCull::CPUCull() = default;
+
+CPUCull::~CPUCull()
+{
+  StopWorkers();
+}
 
 void CPUCull::Init()
 {
@@ -137,8 +187,73 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
-bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                                   const u8* src, u32 count)
+void CPUCull::StartWorkers()
+{
+  m_workers_started = true;
+
+  // Leave room for the CPU and GPU threads, and whatever else the host is doing
+  const int num_workers = std::clamp(cpu_info.num_cores - 3, 0, MAX_WORKERS);
+  for (int i = 0; i < num_workers; i++)
+  {
+    auto worker = std::make_unique<Worker>();
+    worker->thread = std::thread([this, worker = worker.get()] {
+      Common::SetCurrentThreadName("CPUCull Worker");
+      while (true)
+      {
+        worker->start.Wait();
+        if (!worker->slice)
+          break;
+        RunSlice(worker->slice);
+        worker->done.Set();
+      }
+    });
+    m_workers.push_back(std::move(worker));
+  }
+}
+
+void CPUCull::StopWorkers()
+{
+  for (auto& worker : m_workers)
+  {
+    worker->slice = nullptr;
+    worker->start.Set();
+    worker->thread.join();
+  }
+  m_workers.clear();
+  m_workers_started = false;
+}
+
+void CPUCull::RunSlice(Slice* slice)
+{
+  u16* out = slice->out_begin;
+  u32 triangle_begin = slice->first_triangle_end;
+  u32 num_tested = 0;
+  for (u32 begin = slice->begin; begin < slice->end; begin += CHUNK_SIZE)
+  {
+    const u32 end = std::min(begin + CHUNK_SIZE, slice->end);
+    m_transform(&m_transform_buffer[begin], m_src + begin * m_stride, m_stride, end - begin);
+    if (triangle_begin >= end)
+      continue;
+
+    out = m_cull(out, m_transform_buffer.get(), triangle_begin, end);
+    num_tested += CountTriangles(m_primitive, end) - CountTriangles(m_primitive, triangle_begin);
+    triangle_begin = end;
+
+    // Culling only saves GPU work if nothing is left to draw, or if the compacted index list is
+    // much shorter than the original.  Once a quarter of the triangles turn out to be visible,
+    // stop transforming and let the batch be drawn normally.
+    const u32 num_visible = static_cast<u32>(out - slice->out_begin) / 3;
+    if (num_visible * 4 > num_tested || m_give_up.load(std::memory_order_relaxed))
+    {
+      m_give_up.store(true, std::memory_order_relaxed);
+      break;
+    }
+  }
+  slice->out_end = out;
+}
+
+CPUCull::Result CPUCull::CullVertices(VertexLoaderBase* loader,
+                                      OpcodeDecoder::Primitive primitive, const u8* src, u32 count)
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
@@ -150,7 +265,14 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     u32 new_size = MathUtil::NextPowerOf2(count);
     m_transform_buffer_size = new_size;
     m_transform_buffer.reset(static_cast<TransformedVertex*>(
-        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
+        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 64)));
+  }
+  // Every vertex ends at most one triangle.  The extra room is for strip and fan slices which
+  // start writing two triangles in.
+  if (m_index_buffer_size < count * 3 + 6) [[unlikely]]
+  {
+    m_index_buffer_size = MathUtil::NextPowerOf2(count * 3 + 6);
+    m_index_buffer = std::make_unique<u16[]>(m_index_buffer_size);
   }
 
   // transform functions need the projection matrix to tranform to clip space
@@ -163,10 +285,77 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   CullMode cullmode = bpmem.genMode.cullmode;
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cullmode = cullmode_invert[cullmode];
-  const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
-  const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+  m_transform = m_transform_table[posHas3Elems][perVertexPosMtx];
+  m_cull = m_cull_table[primitive][cullmode];
+  m_primitive = primitive;
+  m_src = src;
+  m_stride = stride;
+  m_give_up.store(false, std::memory_order_relaxed);
+
+  const bool strip_or_fan = primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP ||
+                            primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN;
+  const auto make_slice = [&](u32 begin, u32 end) {
+    const u32 first_triangle_end = strip_or_fan ? begin + 2 : begin;
+    u16* out = &m_index_buffer[first_triangle_end * 3];
+    return Slice{begin, end, first_triangle_end, out, out};
+  };
+
+  if (count >= PARALLEL_THRESHOLD && !m_workers_started) [[unlikely]]
+    StartWorkers();
+
+  std::array<Slice, MAX_WORKERS + 2> slices;
+  u32 num_slices = 1;
+  if (count < PARALLEL_THRESHOLD || m_workers.empty())
+  {
+    slices[0] = make_slice(0, count);
+    RunSlice(&slices[0]);
+  }
+  else
+  {
+    // Most batches with visible triangles give up in the first chunk, so check that on its own
+    // before waking the workers.  This also transforms the first vertex, which fans need.
+    slices[0] = make_slice(0, CHUNK_SIZE);
+    RunSlice(&slices[0]);
+    if (!m_give_up.load(std::memory_order_relaxed))
+    {
+      const u32 num_parallel = static_cast<u32>(m_workers.size()) + 1;
+      const u32 slice_size =
+          Common::AlignUp((count - CHUNK_SIZE + num_parallel - 1) / num_parallel, 12);
+      for (u32 begin = CHUNK_SIZE; begin < count; begin += slice_size)
+        slices[num_slices++] = make_slice(begin, std::min(begin + slice_size, count));
+
+      for (u32 i = 2; i < num_slices; i++)
+      {
+        m_workers[i - 2]->slice = &slices[i];
+        m_workers[i - 2]->start.Set();
+      }
+      RunSlice(&slices[1]);
+      for (u32 i = 2; i < num_slices; i++)
+        m_workers[i - 2]->done.Wait();
+    }
+  }
+
+  if (m_give_up.load(std::memory_order_relaxed))
+    return Result::NotCulled;
+
+  // Pack the surviving triangles together, keeping them in their original draw order
+  u16* out = m_index_buffer.get();
+  for (u32 i = 0; i < num_slices; i++)
+  {
+    const Slice& slice = slices[i];
+    if (i != 0 && strip_or_fan)
+    {
+      out = m_cull(out, m_transform_buffer.get(), slice.begin,
+                   std::min(slice.begin + 2, slice.end));
+    }
+    const size_t num_indices = slice.out_end - slice.out_begin;
+    if (out != slice.out_begin)
+      std::memmove(out, slice.out_begin, num_indices * sizeof(u16));
+    out += num_indices;
+  }
+  m_num_compacted_indices = static_cast<u32>(out - m_index_buffer.get());
+
+  return m_num_compacted_indices == 0 ? Result::AllCulled : Result::Compacted;
 }
 
 template <typename T>
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <span>
+#include <vector>
+
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -10,10 +15,27 @@
 class CPUCull
 {
 public:
+  enum class Result
+  {
+    // Every triangle was culled, nothing needs to be drawn
+    AllCulled,
+    // Most triangles were culled, GetCompactedIndices() holds the rest as a triangle list
+    Compacted,
+    // Too many triangles are visible for culling to be worthwhile, draw the batch as-is
+    NotCulled,
+  };
+
+  CPUCull();
   ~CPUCull();
   void Init();
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  Result CullVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                      u32 count);
+  // Indices (relative to the first vertex of the batch) of the triangles which survived the last
+  // call to CullVertices that returned Result::Compacted
+  std::span<const u16> GetCompactedIndices() const
+  {
+    return {m_index_buffer.get(), m_num_compacted_indices};
+  }
 
   struct alignas(16) TransformedVertex
   {
@@ -21,9 +43,25 @@ public:
   };
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullFunction = u16* (*)(u16*, const CPUCull::TransformedVertex*, u32, u32);
 
 private:
+  struct Slice
+  {
+    u32 begin;  // First vertex transformed by this slice
+    u32 end;    // One past the last vertex transformed by this slice
+    // First vertex whose triangle is culled by this slice.  Strips and fans hand the triangles
+    // ending at begin and begin + 1 back to the caller, as they need the previous slice's vertices.
+    u32 first_triangle_end;
+    u16* out_begin;
+    u16* out_end;
+  };
+  struct Worker;
+
+  void RunSlice(Slice* slice);
+  void StartWorkers();
+  void StopWorkers();
+
   template <typename T>
   struct BufferDeleter
   {
@@ -31,8 +69,22 @@ private:
   };
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
+  std::unique_ptr<u16[]> m_index_buffer{};
+  u32 m_index_buffer_size = 0;
+  u32 m_num_compacted_indices = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table{};
+
+  // State of the batch currently being culled, shared with the workers
+  TransformFunction m_transform = nullptr;
+  CullFunction m_cull = nullptr;
+  OpcodeDecoder::Primitive m_primitive{};
+  const u8* m_src = nullptr;
+  u32 m_stride = 0;
+  std::atomic<bool> m_give_up = false;
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  bool m_workers_started = false;
 };
@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !(defined(__AVX512F__) && defined(__FMA__))
+#define ATTR_TARGET __attribute__((target("avx512f,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -236,6 +240,54 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(vector_broadcast<0>(v), m0);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), m1, output);
+  output = _mm512_fmadd_ps(vector_broadcast<2>(v), m2, output);
+  output = _mm512_fmadd_ps(vector_broadcast<3>(v), m3, output);
+  return output;
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m128 LoadPosition(const u8* data)
+{
+  const float* fdata = reinterpret_cast<const float*>(data);
+  if constexpr (PositionHas3Elems)
+    return _mm_loadu_ps(fdata);
+  else
+    return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(fdata));
+}
+
+// Same as TransformVertexYMM, with one vertex in each of the four 128-bit lanes
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  __m512 vertex = _mm512_castps128_ps512(LoadPosition<PositionHas3Elems>(data));
+  vertex = _mm512_insertf32x4(vertex, LoadPosition<PositionHas3Elems>(data + stride), 1);
+  vertex = _mm512_insertf32x4(vertex, LoadPosition<PositionHas3Elems>(data + stride * 2), 2);
+  vertex = _mm512_insertf32x4(vertex, LoadPosition<PositionHas3Elems>(data + stride * 3), 3);
+
+  __m512 output = pos3;  // vertex.w is always 1.0
+  output = _mm512_fmadd_ps(vector_broadcast<0>(vertex), pos0, output);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(vertex), pos1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm512_fmadd_ps(vector_broadcast<2>(vertex), pos2, output);
+  return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -517,6 +569,29 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+#ifdef USE_AVX512
+  // Per-vertex position matrices need a separate matrix load for every vertex, which the wider
+  // registers don't help with, so those stick to the YMM path.
+  if constexpr (!PerVertexPosMtx)
+  {
+    const __m512 zproj0 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(proj0));
+    const __m512 zproj1 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(proj1));
+    const __m512 zproj2 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(proj2));
+    const __m512 zproj3 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(proj3));
+    const __m512 zpos0 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(pos0));
+    const __m512 zpos1 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(pos1));
+    const __m512 zpos2 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(pos2));
+    const __m512 zpos3 = _mm512_broadcast_f32x4(_mm256_castps256_ps128(pos3));
+    for (; count >= 4; count -= 4)
+    {
+      __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems>(
+          cvertices, stride, zpos0, zpos1, zpos2, zpos3, zproj0, zproj1, zproj2, zproj3);
+      _mm512_store_ps(reinterpret_cast<float*>(voutput), v0123);
+      cvertices += stride * 4;
+      voutput += 4;
+    }
+  }
+#endif
   for (int i = 1; i < count; i += 2)
   {
     const u8* v0data = cvertices;
@@ -653,59 +728,61 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u16* CullAndEmitTriangle(
+    u16* out, const CPUCull::TransformedVertex* transformed, u32 a, u32 b, u32 c)
+{
+  if (!CullTriangle<Mode>(transformed[a], transformed[b], transformed[c]))
+  {
+    out[0] = static_cast<u16>(a);
+    out[1] = static_cast<u16>(b);
+    out[2] = static_cast<u16>(c);
+    out += 3;
+  }
+  return out;
+}
+
+// Culls every triangle whose last vertex is in [begin, end), and writes the indices of the ones
+// that survive to out as a triangle list.  begin must be on a primitive boundary (a multiple of 12
+// works for every primitive type).
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
-ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+ATTR_TARGET static u16* CullTriangles(u16* out, const CPUCull::TransformedVertex* transformed,
+                                      u32 begin, u32 end)
 {
   switch (Primitive)
   {
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
   {
-    int i = 3;
-    for (; i < count; i += 4)
+    u32 i = begin + 3;
+    for (; i < end; i += 4)
     {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 1], transformed[i - 0]))
-        return false;
+      out = CullAndEmitTriangle<Mode>(out, transformed, i - 3, i - 2, i - 1);
+      out = CullAndEmitTriangle<Mode>(out, transformed, i - 3, i - 1, i - 0);
     }
     // three vertices remaining, so render a triangle
-    if (i == count)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-    }
+    if (i == end)
+      out = CullAndEmitTriangle<Mode>(out, transformed, i - 3, i - 2, i - 1);
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
-    for (int i = 2; i < count; i += 3)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - 1], transformed[i - 0]))
-        return false;
-    }
+    for (u32 i = begin + 2; i < end; i += 3)
+      out = CullAndEmitTriangle<Mode>(out, transformed, i - 2, i - 1, i - 0);
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
-  {
-    bool wind = false;
-    for (int i = 2; i < count; ++i)
+    for (u32 i = std::max(begin, 2u); i < end; ++i)
     {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
-        return false;
-      wind = !wind;
+      const u32 wind = i & 1;
+      out = CullAndEmitTriangle<Mode>(out, transformed, i - 2, i - !wind, i - wind);
     }
     break;
-  }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
-    for (int i = 2; i < count; ++i)
-    {
-      if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
-        return false;
-    }
+    for (u32 i = std::max(begin, 2u); i < end; ++i)
+      out = CullAndEmitTriangle<Mode>(out, transformed, 0, i - 1, i);
     break;
   }
 
-  return true;
+  return out;
 }
 
 }  // namespace VECTOR_NAMESPACE
@@ -13,6 +13,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Tracer.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -150,7 +151,10 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
-    m_gpu_mainloop.Wait();
+    {
+      Common::Tracer::ScopedEvent trace("Wait for GPU", "GPU");
+      m_gpu_mainloop.Wait();
+    }
     if (!m_gpu_mainloop.IsRunning())
       return;
 
@@ -307,6 +311,7 @@ void FifoManager::RunGpuLoop()
           // See comment in SyncGPU
           if (write_ptr > seen_ptr)
           {
+            Common::Tracer::ScopedEvent trace("Run FIFO", "GPU");
             m_video_buffer_read_ptr =
                 OpcodeDecoder::RunFifo(DataReader(m_video_buffer_read_ptr, write_ptr), nullptr);
             m_video_buffer_seen_ptr = write_ptr;
@@ -314,6 +319,7 @@ void FifoManager::RunGpuLoop()
         }
         else
         {
+          Common::Tracer::ScopedEvent trace("Run FIFO", "GPU");
           auto& command_processor = m_system.GetCommandProcessor();
           auto& fifo = command_processor.GetFifo();
           command_processor.SetCPStatusFromGPU();
@@ -559,7 +565,10 @@ int FifoManager::WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
+  {
+    Common::Tracer::ScopedEvent trace("Wait for GPU", "GPU");
     m_sync_wakeup_event.Wait();
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
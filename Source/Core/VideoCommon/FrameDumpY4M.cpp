@@ -0,0 +1,217 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameDumpY4M.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/HW/VideoInterface.h"
+#include "Core/System.h"
+
+#include "VideoCommon/FrameDumpFFMpeg.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+constexpr std::string_view FD_PATH_PREFIX = "fd:";
+
+std::FILE* OpenFileDescriptor(int fd)
+{
+  // Duplicate the descriptor, so that closing the stream leaves the inherited one open.
+#ifdef _WIN32
+  const int new_fd = _dup(fd);
+  std::FILE* const file = new_fd >= 0 ? _fdopen(new_fd, "wb") : nullptr;
+  if (new_fd >= 0 && !file)
+    _close(new_fd);
+#else
+  const int new_fd = dup(fd);
+  std::FILE* const file = new_fd >= 0 ? fdopen(new_fd, "wb") : nullptr;
+  if (new_fd >= 0 && !file)
+    close(new_fd);
+#endif
+  return file;
+}
+
+// Converts a row of RGBA8 pixels to full range BT.601 YCbCr planes.
+void ConvertRow(const u8* src, u8* y, u8* cb, u8* cr, int width)
+{
+  for (int x = 0; x < width; x++, src += 4)
+  {
+    const int r = src[0];
+    const int g = src[1];
+    const int b = src[2];
+    y[x] = static_cast<u8>((77 * r + 150 * g + 29 * b + 128) >> 8);
+    cb[x] = static_cast<u8>(std::min(((-43 * r - 85 * g + 128 * b + 128) >> 8) + 128, 255));
+    cr[x] = static_cast<u8>(std::min(((128 * r - 107 * g - 21 * b + 128) >> 8) + 128, 255));
+  }
+}
+}  // namespace
+
+Y4MFrameDump::Y4MFrameDump() = default;
+
+Y4MFrameDump::~Y4MFrameDump()
+{
+  Stop();
+}
+
+bool Y4MFrameDump::OpenOutput()
+{
+  const std::string& dump_path = g_Config.sDumpPath;
+  if (dump_path.starts_with(FD_PATH_PREFIX))
+  {
+    int fd;
+    if (!TryParse(dump_path.substr(FD_PATH_PREFIX.size()), &fd) || fd < 0)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Invalid file descriptor {}", dump_path);
+      return false;
+    }
+    m_file.SetHandle(OpenFileDescriptor(fd));
+  }
+  else if (!dump_path.empty())
+  {
+    // Named pipes must not be truncated or deleted, so they are simply opened for writing.
+    m_file.Open(dump_path, "wb");
+  }
+  else
+  {
+    const std::string path = fmt::format(
+        "{}{}_{:%Y-%m-%d_%H-%M-%S}_{}.y4m", File::GetUserPath(D_DUMPFRAMES_IDX),
+        SConfig::GetInstance().GetGameID(), fmt::localtime(m_start_time), m_file_index);
+    if (File::Exists(path) && !Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES_SILENT) &&
+        !AskYesNoFmtT("Delete the existing file '{0}'?", path))
+    {
+      return false;
+    }
+
+    File::CreateFullPath(path);
+    m_file.Open(path, "wb");
+  }
+
+  if (!m_file.IsOpen())
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not open {} for frame dumping", dump_path);
+    return false;
+  }
+  return true;
+}
+
+bool Y4MFrameDump::Start(int w, int h)
+{
+  if (IsStarted())
+    return true;
+
+  m_start_time = std::time(nullptr);
+  m_file_index = 0;
+  return StartFile(w, h);
+}
+
+bool Y4MFrameDump::StartFile(int w, int h)
+{
+  if (!OpenOutput())
+  {
+    OSD::AddMessage("FrameDump Start failed");
+    return false;
+  }
+
+  auto& vi = Core::System::GetInstance().GetVideoInterface();
+  u32 rate_num = vi.GetTargetRefreshRateNumerator();
+  u32 rate_den = vi.GetTargetRefreshRateDenominator();
+  const u32 divisor = std::gcd(rate_num, rate_den);
+  if (divisor != 0)
+  {
+    rate_num /= divisor;
+    rate_den /= divisor;
+  }
+
+  m_width = w;
+  m_height = h;
+  m_buffer.resize(static_cast<size_t>(w) * h * 3);
+
+  const std::string header =
+      fmt::format("YUV4MPEG2 W{} H{} F{}:{} Ip A1:1 C444 XCOLORRANGE=FULL\n", w, h, rate_num,
+                  std::max(rate_den, 1u));
+  if (!m_file.WriteString(header))
+  {
+    Stop();
+    return false;
+  }
+
+  OSD::AddMessage(fmt::format("Dumping Frames to Y4M ({}x{})", w, h));
+  return true;
+}
+
+void Y4MFrameDump::AddFrame(const FrameData& frame)
+{
+  if (!IsStarted())
+    return;
+
+  // Y4M streams can't change resolution, so start a new file. Dumping to a fixed path or file
+  // descriptor would overwrite or corrupt the stream instead, so those drop the frame.
+  if (frame.width != m_width || frame.height != m_height)
+  {
+    if (!g_Config.sDumpPath.empty())
+    {
+      WARN_LOG_FMT(FRAMEDUMP, "Dropping {}x{} frame from {}x{} Y4M dump", frame.width,
+                   frame.height, m_width, m_height);
+      return;
+    }
+
+    Stop();
+    ++m_file_index;
+    if (!StartFile(frame.width, frame.height))
+      return;
+  }
+
+  const size_t plane_size = static_cast<size_t>(m_width) * m_height;
+  u8* const y_plane = m_buffer.data();
+  u8* const cb_plane = y_plane + plane_size;
+  u8* const cr_plane = cb_plane + plane_size;
+  for (int row = 0; row < m_height; row++)
+  {
+    const size_t offset = static_cast<size_t>(row) * m_width;
+    ConvertRow(frame.data + static_cast<size_t>(row) * frame.stride, y_plane + offset,
+               cb_plane + offset, cr_plane + offset, m_width);
+  }
+
+  static constexpr std::string_view FRAME_HEADER = "FRAME\n";
+  if (!m_file.WriteString(FRAME_HEADER) || !m_file.WriteBytes(m_buffer.data(), m_buffer.size()))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Failed to write frame, stopping Y4M dump");
+    Stop();
+  }
+}
+
+void Y4MFrameDump::Stop()
+{
+  if (!IsStarted())
+    return;
+
+  m_file.Close();
+  OSD::AddMessage("Stopped dumping frames");
+}
+
+bool Y4MFrameDump::IsStarted() const
+{
+  return m_file.IsOpen();
+}
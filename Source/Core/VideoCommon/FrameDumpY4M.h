@@ -0,0 +1,43 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <ctime>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+struct FrameData;
+
+// Writes frames as an uncompressed YUV4MPEG2 stream. This skips encoding entirely, which keeps up
+// with emulation where FFmpeg encoding doesn't, and is available without FFmpeg. The dump path can
+// name a pipe, or be "fd:<number>" to write to an inherited file descriptor, so that an external
+// encoder or comparison tool can consume the frames directly.
+class Y4MFrameDump
+{
+public:
+  Y4MFrameDump();
+  ~Y4MFrameDump();
+
+  bool Start(int w, int h);
+  void AddFrame(const FrameData& frame);
+  void Stop();
+  bool IsStarted() const;
+
+private:
+  bool StartFile(int w, int h);
+  bool OpenOutput();
+
+  File::IOFile m_file;
+  int m_width = 0;
+  int m_height = 0;
+
+  // Holds the planes of a frame, so that each frame is written with a single call.
+  std::vector<u8> m_buffer;
+
+  // Used for filename generation.
+  std::time_t m_start_time = {};
+  u32 m_file_index = 0;
+};
@@ -3,7 +3,12 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
 
@@ -21,6 +26,16 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
+// Dump format which selects the built-in Y4M writer instead of an FFmpeg muxer.
+static constexpr std::string_view Y4M_DUMP_FORMAT = "y4m";
+
+enum class FrameDumpOutput
+{
+  FFMpeg,
+  Y4M,
+  Image,
+};
+
 static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 {
   return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
@@ -62,13 +77,24 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // If every readback texture is waiting to be encoded, make room for this frame.
+  if (m_frame_dump_readback_count == FRAME_DUMP_READBACK_DEPTH)
+    FlushFrameDumpReadbacks(FRAME_DUMP_READBACK_DEPTH - 1);
+
+  FrameDumpReadback& readback =
+      m_frame_dump_readbacks[(m_frame_dump_readback_head + m_frame_dump_readback_count) %
+                             FRAME_DUMP_READBACK_DEPTH];
+
+  // The frame dump thread may still be reading the previous frame from this texture.
+  if (readback.texture.get() == m_frame_dump_output_texture)
+    FinishFrameData();
+
+  if (!CheckFrameDumpReadbackTexture(readback.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback.texture->GetRect());
+  readback.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_frame_dump_readback_count++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -99,9 +125,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -118,38 +144,50 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_frame_dump_readback_count == 0)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  // Screenshots shouldn't wait for further frames.
+  const bool dumping_frames = Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES);
+  FlushFrameDumpReadbacks(dumping_frames ? FRAME_DUMP_READBACK_DEPTH - 1 : 0);
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
-  {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
-  }
-  else
+void FrameDumper::FlushFrameDumpReadbacks(size_t max_pending)
+{
+  while (m_frame_dump_readback_count > max_pending)
   {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
-  }
+    FrameDumpReadback& readback = m_frame_dump_readbacks[m_frame_dump_readback_head];
+    m_frame_dump_readback_head = (m_frame_dump_readback_head + 1) % FRAME_DUMP_READBACK_DEPTH;
+    m_frame_dump_readback_count--;
 
-  m_frame_dump_needs_flush = false;
+    // Ensure dumping thread is done with the previous output texture.
+    FinishFrameData();
 
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+    // Queue encoding of the oldest frame dumped.
+    AbstractStagingTexture* output = readback.texture.get();
+    output->Flush();
+    if (output->Map())
+    {
+      m_frame_dump_output_texture = output;
+      DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
+                    output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                    readback.state);
+    }
+    else
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    }
+  }
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the queued readbacks have been sent to the encoder.
+  FlushFrameDumpReadbacks(0);
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
@@ -165,13 +203,14 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (FrameDumpReadback& readback : m_frame_dump_readbacks)
+    readback.texture.reset();
+  m_frame_dump_readback_head = 0;
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -183,34 +222,36 @@ void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
 void FrameDumper::FinishFrameData()
 {
-  if (!m_frame_dump_frame_running)
+  if (!m_frame_dump_output_texture)
     return;
 
   m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
-
   m_frame_dump_output_texture->Unmap();
+  m_frame_dump_output_texture = nullptr;
 }
 
 void FrameDumper::FrameDumpThreadFunc()
 {
   Common::SetCurrentThreadName("FrameDumping");
 
-  bool dump_to_ffmpeg = !g_ActiveConfig.bDumpFramesAsImages;
+  FrameDumpOutput output = FrameDumpOutput::FFMpeg;
+  if (g_ActiveConfig.bDumpFramesAsImages)
+    output = FrameDumpOutput::Image;
+  else if (g_ActiveConfig.sDumpFormat == Y4M_DUMP_FORMAT)
+    output = FrameDumpOutput::Y4M;
   bool frame_dump_started = false;
 
-// If Dolphin was compiled without ffmpeg, we only support dumping to images.
+// If Dolphin was compiled without ffmpeg, we only support dumping to images and Y4M.
 #if !defined(HAVE_FFMPEG)
-  if (dump_to_ffmpeg)
+  if (output == FrameDumpOutput::FFMpeg)
   {
     WARN_LOG_FMT(VIDEO, "FrameDump: Dolphin was not compiled with FFmpeg, using fallback option. "
                         "Frames will be saved as PNG images instead.");
-    dump_to_ffmpeg = false;
+    output = FrameDumpOutput::Image;
   }
 #endif
 
@@ -239,10 +280,18 @@ void FrameDumper::FrameDumpThreadFunc()
     {
       if (!frame_dump_started)
       {
-        if (dump_to_ffmpeg)
+        switch (output)
+        {
+        case FrameDumpOutput::FFMpeg:
           frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
+          break;
+        case FrameDumpOutput::Y4M:
+          frame_dump_started = m_y4m_dump.Start(frame.width, frame.height);
+          break;
+        case FrameDumpOutput::Image:
           frame_dump_started = StartFrameDumpToImage(frame);
+          break;
+        }
 
         // Stop frame dumping if we fail to start.
         if (!frame_dump_started)
@@ -252,10 +301,18 @@ void FrameDumper::FrameDumpThreadFunc()
       // If we failed to start frame dumping, don't write a frame.
       if (frame_dump_started)
       {
-        if (dump_to_ffmpeg)
+        switch (output)
+        {
+        case FrameDumpOutput::FFMpeg:
           DumpFrameToFFMPEG(frame);
-        else
+          break;
+        case FrameDumpOutput::Y4M:
+          m_y4m_dump.AddFrame(frame);
+          break;
+        case FrameDumpOutput::Image:
           DumpFrameToImage(frame);
+          break;
+        }
       }
     }
 
@@ -264,9 +321,18 @@ void FrameDumper::FrameDumpThreadFunc()
 
   if (frame_dump_started)
   {
-    // No additional cleanup is needed when dumping to images.
-    if (dump_to_ffmpeg)
+    switch (output)
+    {
+    case FrameDumpOutput::FFMpeg:
       StopFrameDumpToFFMPEG();
+      break;
+    case FrameDumpOutput::Y4M:
+      m_y4m_dump.Stop();
+      break;
+    case FrameDumpOutput::Image:
+      StopFrameDumpToImage();
+      break;
+    }
   }
 }
 
@@ -317,6 +383,20 @@ std::string FrameDumper::GetFrameDumpNextImageFileName() const
 bool FrameDumper::StartFrameDumpToImage(const FrameData&)
 {
   m_frame_dump_image_counter = 1;
+  m_next_image_encoder = 0;
+
+  const int num_encoders = std::clamp(cpu_info.num_cores - 2, 1, 8);
+  m_image_encoders.clear();
+  for (int i = 0; i < num_encoders; i++)
+  {
+    m_image_encoders.push_back(std::make_unique<Common::WorkQueueThread<ImageDumpJob>>(
+        "PNG Encoder", [](ImageDumpJob job) {
+          Common::ConvertRGBAToRGBAndSavePNG(job.filename, job.data.data(), job.width, job.height,
+                                             job.width * 4,
+                                             Config::Get(Config::GFX_PNG_COMPRESSION_LEVEL));
+        }));
+  }
+
   if (!Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES_SILENT))
   {
     // Only check for the presence of the first image to confirm overwriting.
@@ -335,10 +415,27 @@ bool FrameDumper::StartFrameDumpToImage(const FrameData&)
 
 void FrameDumper::DumpFrameToImage(const FrameData& frame)
 {
-  DumpFrameToPNG(frame, GetFrameDumpNextImageFileName());
+  // Each encoder has at most one frame queued, which bounds the number of frame copies.
+  auto& encoder = m_image_encoders[m_next_image_encoder];
+  m_next_image_encoder = (m_next_image_encoder + 1) % m_image_encoders.size();
+  encoder->WaitForCompletion();
+
+  // The frame data is only valid until the next frame is queued, so the encoder gets a copy.
+  ImageDumpJob job{GetFrameDumpNextImageFileName(), {}, frame.width, frame.height};
+  const size_t row_size = static_cast<size_t>(frame.width) * 4;
+  job.data.resize(row_size * frame.height);
+  for (int row = 0; row < frame.height; row++)
+    std::memcpy(job.data.data() + row * row_size, frame.data + row * frame.stride, row_size);
+  encoder->Push(std::move(job));
   m_frame_dump_image_counter++;
 }
 
+void FrameDumper::StopFrameDumpToImage()
+{
+  // Waits for the queued images to be written.
+  m_image_encoders.clear();
+}
+
 void FrameDumper::SaveScreenshot(std::string filename)
 {
   std::lock_guard<std::mutex> lk(m_screenshot_lock);
@@ -3,13 +3,22 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
 #include "Common/Thread.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
+#include "VideoCommon/FrameDumpY4M.h"
 #include "VideoCommon/VideoEvents.h"
 
 class AbstractStagingTexture;
@@ -22,10 +31,11 @@ public:
   FrameDumper();
   ~FrameDumper();
 
-  // Ensures all rendered frames are queued for encoding.
+  // Queues the rendered frames which have been read back for encoding. While dumping frames, the
+  // most recent ones are left in flight, so that mapping them doesn't wait for the GPU.
   void FlushFrameDump();
 
-  // Fills the frame dump staging texture with the current XFB texture.
+  // Copies the current XFB texture to the next frame dump staging texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
                         const MathUtil::Rectangle<int>& target_rect, u64 ticks, int frame_number);
@@ -38,6 +48,23 @@ public:
   void DoState(PointerWrap& p);
 
 private:
+  // Number of staging textures frames are read back through.
+  static constexpr size_t FRAME_DUMP_READBACK_DEPTH = 3;
+
+  struct FrameDumpReadback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    FrameState state;
+  };
+
+  struct ImageDumpJob
+  {
+    std::string filename;
+    std::vector<u8> data;
+    int width;
+    int height;
+  };
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameData&);
@@ -46,17 +73,22 @@ private:
   std::string GetFrameDumpNextImageFileName() const;
   bool StartFrameDumpToImage(const FrameData&);
   void DumpFrameToImage(const FrameData&);
+  void StopFrameDumpToImage();
 
   void ShutdownFrameDumping();
 
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that a frame dump readback texture exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& texture,
+                                     u32 target_width, u32 target_height);
+
+  // Queues encoding of readbacks, oldest first, until at most max_pending are left.
+  void FlushFrameDumpReadbacks(size_t max_pending);
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -70,9 +102,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,18 +109,25 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Ring of readback textures. Frames are copied to these on the GPU timeline, and only mapped
+  // a few frames later, by which point the copy has completed.
+  std::array<FrameDumpReadback, FRAME_DUMP_READBACK_DEPTH> m_frame_dump_readbacks;
+  // Index of the oldest readback which has not been queued for encoding, and number of them.
+  size_t m_frame_dump_readback_head = 0;
+  size_t m_frame_dump_readback_count = 0;
+  // Readback texture mapped for the frame dump thread, if any.
+  AbstractStagingTexture* m_frame_dump_output_texture = nullptr;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
 
   FFMpegFrameDump m_ffmpeg_dump;
+  Y4MFrameDump m_y4m_dump;
+
+  // PNG compression is by far the slowest part of dumping frames as images, so the frame dump
+  // thread hands copies of the frames to these, round robin.
+  std::vector<std::unique_ptr<Common::WorkQueueThread<ImageDumpJob>>> m_image_encoders;
+  size_t m_next_image_encoder = 0;
 
   // Screenshots
   Common::Flag m_screenshot_request;
@@ -21,6 +21,9 @@ namespace VideoCommon
 // caches to be invalidated.
 constexpr u32 GX_PIPELINE_UID_VERSION = 8;  // Last changed in PR 12185
 
+// Per-game pipeline UID caches start with this magic, followed by GX_PIPELINE_UID_VERSION.
+constexpr u32 GX_PIPELINE_UID_CACHE_MAGIC = 0x44495550;  // PUID
+
 struct GXPipelineUid
 {
   const NativeVertexFormat* vertex_format;
@@ -37,6 +37,17 @@ u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
   return index_ptr;
 }
 
+template <bool pr>
+u16* AddTriangleList(u16* index_ptr, std::span<const u16> triangles, u32 index)
+{
+  for (size_t i = 2; i < triangles.size(); i += 3)
+  {
+    index_ptr = WriteTriangle<pr>(index_ptr, index + triangles[i - 2], index + triangles[i - 1],
+                                  index + triangles[i]);
+  }
+  return index_ptr;
+}
+
 template <bool pr>
 u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
@@ -273,6 +284,7 @@ void IndexGenerator::Init()
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<true>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_STRIP] = AddStrip<true>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_FAN] = AddFan<true>;
+    m_triangle_list_function = AddTriangleList<true>;
   }
   else
   {
@@ -281,6 +293,7 @@ void IndexGenerator::Init()
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<false>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_STRIP] = AddStrip<false>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_FAN] = AddFan<false>;
+    m_triangle_list_function = AddTriangleList<false>;
   }
   if (g_Config.UseVSForLinePointExpand())
   {
@@ -326,6 +339,13 @@ void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddTriangleIndices(std::span<const u16> triangles, u32 num_vertices)
+{
+  m_index_buffer_current =
+      m_triangle_list_function(m_index_buffer_current, triangles, m_base_index);
+  m_base_index += num_vertices;
+}
+
 u32 IndexGenerator::GetRemainingIndices(OpcodeDecoder::Primitive primitive) const
 {
   u32 max_index = UINT16_MAX;
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -20,6 +22,9 @@ public:
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
+  // Adds a triangle list with indices relative to the first of num_vertices new vertices
+  void AddTriangleIndices(std::span<const u16> triangles, u32 num_vertices);
+
   // returns numprimitives
   u32 GetNumVerts() const { return m_base_index; }
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
@@ -32,4 +37,7 @@ private:
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
+
+  using TriangleListFunction = u16* (*)(u16*, std::span<const u16>, u32);
+  TriangleListFunction m_triangle_list_function = nullptr;
 };
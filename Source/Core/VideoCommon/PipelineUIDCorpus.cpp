@@ -0,0 +1,201 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace VideoCommon::PipelineUIDCorpus
+{
+namespace
+{
+constexpr u32 CORPUS_MAGIC = 0x524F4350;  // PCOR
+
+#pragma pack(push, 1)
+struct CorpusHeader
+{
+  u32 magic;
+  u32 version;
+  u32 num_sources;
+  u32 num_entries;
+};
+
+// A UID cache the corpus was built from. UID caches are only ever appended to, so the size
+// changes whenever the title recorded a new UID.
+struct CorpusSource
+{
+  u32 name_crc;
+  u64 size;
+};
+
+struct CorpusEntry
+{
+  SerializedGXPipelineUid uid;
+  u32 num_titles;
+};
+#pragma pack(pop)
+
+// Serialized UIDs have all padding zeroed, so they can be compared bytewise.
+bool UIDLess(const SerializedGXPipelineUid& lhs, const SerializedGXPipelineUid& rhs)
+{
+  return std::memcmp(&lhs, &rhs, sizeof(SerializedGXPipelineUid)) < 0;
+}
+
+bool UIDEqual(const SerializedGXPipelineUid& lhs, const SerializedGXPipelineUid& rhs)
+{
+  return std::memcmp(&lhs, &rhs, sizeof(SerializedGXPipelineUid)) == 0;
+}
+
+std::vector<CorpusSource> GetSources(const std::vector<std::string>& paths)
+{
+  std::vector<CorpusSource> sources;
+  sources.reserve(paths.size());
+  for (const std::string& path : paths)
+    sources.push_back({Common::ComputeCRC32(PathToFileName(path)), File::GetSize(path)});
+  return sources;
+}
+
+// The running title's own UID cache grows as it plays, but the UIDs it adds are already in its
+// pipeline cache and are never taken from the corpus, so a change to it alone doesn't make the
+// corpus outdated. Otherwise, every boot would rebuild it.
+bool SourcesMatch(const std::vector<CorpusSource>& stored,
+                  const std::vector<CorpusSource>& current, u32 title_name_crc)
+{
+  return std::ranges::equal(stored, current, [&](const CorpusSource& a, const CorpusSource& b) {
+    return a.name_crc == b.name_crc && (a.size == b.size || a.name_crc == title_name_crc);
+  });
+}
+
+// Returns the distinct UIDs in a per-game UID cache, sorted bytewise.
+std::vector<SerializedGXPipelineUid> ReadUIDCache(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  u32 magic, version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != GX_PIPELINE_UID_CACHE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return {};
+  }
+
+  // A partially written UID at the end of the file is ignored.
+  const u64 data_size = file.GetSize() - file.Tell();
+  std::vector<SerializedGXPipelineUid> uids(data_size / sizeof(SerializedGXPipelineUid));
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return {};
+
+  std::sort(uids.begin(), uids.end(), UIDLess);
+  uids.erase(std::unique(uids.begin(), uids.end(), UIDEqual), uids.end());
+  return uids;
+}
+
+std::vector<CorpusEntry> BuildCorpus(const std::vector<std::string>& paths)
+{
+  // Each cache contributes every UID at most once, so the number of copies of a UID is the
+  // number of titles which used it.
+  std::vector<SerializedGXPipelineUid> all_uids;
+  for (const std::string& path : paths)
+  {
+    const std::vector<SerializedGXPipelineUid> uids = ReadUIDCache(path);
+    all_uids.insert(all_uids.end(), uids.begin(), uids.end());
+  }
+  std::sort(all_uids.begin(), all_uids.end(), UIDLess);
+
+  std::vector<CorpusEntry> entries;
+  for (auto it = all_uids.begin(); it != all_uids.end();)
+  {
+    const auto run_end = std::find_if_not(
+        it, all_uids.end(), [&](const SerializedGXPipelineUid& uid) { return UIDEqual(uid, *it); });
+    const u32 num_titles = static_cast<u32>(run_end - it);
+    if (num_titles >= 2)
+      entries.push_back({*it, num_titles});
+    it = run_end;
+  }
+
+  // Stable, so that ties stay in a deterministic order.
+  std::stable_sort(entries.begin(), entries.end(), [](const CorpusEntry& a, const CorpusEntry& b) {
+    return a.num_titles > b.num_titles;
+  });
+  return entries;
+}
+
+std::optional<std::vector<CorpusEntry>> LoadCorpus(const std::string& path,
+                                                   const std::vector<CorpusSource>& sources,
+                                                   u32 title_name_crc)
+{
+  File::IOFile file(path, "rb");
+  CorpusHeader header;
+  if (!file.ReadBytes(&header, sizeof(header)) || header.magic != CORPUS_MAGIC ||
+      header.version != GX_PIPELINE_UID_VERSION || header.num_sources != sources.size() ||
+      file.GetSize() != sizeof(header) + u64{header.num_sources} * sizeof(CorpusSource) +
+                            u64{header.num_entries} * sizeof(CorpusEntry))
+  {
+    return std::nullopt;
+  }
+
+  std::vector<CorpusSource> stored_sources(header.num_sources);
+  if (!file.ReadArray(stored_sources.data(), stored_sources.size()) ||
+      !SourcesMatch(stored_sources, sources, title_name_crc))
+  {
+    return std::nullopt;
+  }
+
+  std::vector<CorpusEntry> entries(header.num_entries);
+  if (!file.ReadArray(entries.data(), entries.size()))
+    return std::nullopt;
+  return entries;
+}
+
+void WriteCorpus(const std::string& path, const std::vector<CorpusSource>& sources,
+                 const std::vector<CorpusEntry>& entries)
+{
+  const CorpusHeader header = {CORPUS_MAGIC, GX_PIPELINE_UID_VERSION,
+                               static_cast<u32>(sources.size()), static_cast<u32>(entries.size())};
+  File::IOFile file(path, "wb");
+  if (!file.WriteBytes(&header, sizeof(header)) ||
+      !file.WriteArray(sources.data(), sources.size()) ||
+      !file.WriteArray(entries.data(), entries.size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline UID corpus to {}", path);
+    file.Close();
+    File::Delete(path);
+  }
+}
+}  // namespace
+
+std::vector<SerializedGXPipelineUid> GetSharedPipelineUIDs(const std::string& cache_dir,
+                                                           const std::string& game_id,
+                                                           size_t max_count)
+{
+  std::vector<std::string> paths = Common::DoFileSearch({cache_dir}, {".uidcache"});
+  std::sort(paths.begin(), paths.end());
+  const std::vector<CorpusSource> sources = GetSources(paths);
+  const u32 title_name_crc = Common::ComputeCRC32(game_id + ".uidcache");
+
+  const std::string corpus_path = cache_dir + CORPUS_FILENAME;
+  std::optional<std::vector<CorpusEntry>> entries =
+      LoadCorpus(corpus_path, sources, title_name_crc);
+  if (!entries)
+  {
+    entries = BuildCorpus(paths);
+    WriteCorpus(corpus_path, sources, *entries);
+    INFO_LOG_FMT(VIDEO, "Built pipeline UID corpus of {} shared UIDs from {} UID caches",
+                 entries->size(), paths.size());
+  }
+
+  std::vector<SerializedGXPipelineUid> uids;
+  uids.reserve(std::min(entries->size(), max_count));
+  for (size_t i = 0; i < entries->size() && i < max_count; i++)
+    uids.push_back((*entries)[i].uid);
+  return uids;
+}
+}  // namespace VideoCommon::PipelineUIDCorpus
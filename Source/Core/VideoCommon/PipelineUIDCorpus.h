@@ -0,0 +1,28 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "VideoCommon/GXPipelineTypes.h"
+
+// Many titles are built on the same engines and SDK libraries, and end up using a lot of the same
+// pipelines. The corpus merges the per-game pipeline UID caches in the cache directory, and ranks
+// the UIDs by the number of titles which used them, so that a title which has never been run
+// before can precompile the pipelines it is most likely to need.
+namespace VideoCommon::PipelineUIDCorpus
+{
+// Name of the merged corpus, relative to the cache directory.
+constexpr char CORPUS_FILENAME[] = "shared.uidcorpus";
+
+// Returns up to max_count UIDs used by at least two titles, most widely used first. The corpus
+// is rebuilt from the per-game UID caches in cache_dir whenever any of them other than the one
+// of the running title (game_id) changed since it was last written, and loaded from disk
+// otherwise.
+std::vector<SerializedGXPipelineUid> GetSharedPipelineUIDs(const std::string& cache_dir,
+                                                           const std::string& game_id,
+                                                           size_t max_count);
+}  // namespace VideoCommon::PipelineUIDCorpus
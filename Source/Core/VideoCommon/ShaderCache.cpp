@@ -8,6 +8,7 @@
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Tracer.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractGfx.h"
@@ -15,6 +16,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -68,6 +70,14 @@ void ShaderCache::InitializeShaderCache()
 
   // Compile all known UIDs.
   CompileMissingPipelines();
+
+  // After those, compile what other titles have used, in case this title uses it too.
+  if (g_ActiveConfig.bPrecompileSharedPipelines && g_ActiveConfig.bShaderCache &&
+      m_api_type != APIType::Nothing)
+  {
+    QueueSharedPipelines();
+  }
+
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
     WaitForAsyncCompiler();
 
@@ -77,7 +87,11 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
+  // Drop the shared pipelines which are still queued, and forget the ones this title never used.
+  m_shared_pipeline_deadline = std::chrono::steady_clock::time_point::min();
   WaitForAsyncCompiler();
+  std::erase_if(m_gx_pipeline_cache, [](const auto& it) { return it.second.shared; });
+
   ClosePipelineUIDCache();
   ClearCaches();
 
@@ -117,14 +131,22 @@ void ShaderCache::Shutdown()
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_pipeline_cache.end())
+  {
+    if (it->second.shared) [[unlikely]]
+      RecordSharedPipelineUse(uid, it->second);
+    if (!it->second.second)
+      return it->second.first.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    Common::Tracer::ScopedEvent trace("Compile pipeline", "Shaders");
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
@@ -135,6 +157,9 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
+    if (it->second.shared) [[unlikely]]
+      RecordSharedPipelineUse(uid, it->second);
+
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
@@ -156,7 +181,10 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    Common::Tracer::ScopedEvent trace("Compile uber pipeline", "Shaders");
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
@@ -263,7 +291,7 @@ void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type,
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
   CacheReader reader(cache);
-  u32 count = cache.disk_cache.OpenAndRead(filename, reader);
+  u32 count = cache.disk_cache.OpenAndRead(filename, reader, DISK_SHADER_CACHE_VERSION);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
 }
 
@@ -317,8 +345,10 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
   };
 
   std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  // Pipelines depend on both the generated shaders and the layout of the pipeline UIDs
+  constexpr u32 entry_version = (GX_PIPELINE_UID_VERSION << 16) | DISK_SHADER_CACHE_VERSION;
   CacheReader reader(this, cache);
-  const u32 count = disk_cache.OpenAndRead(filename, reader);
+  const u32 count = disk_cache.OpenAndRead(filename, reader, entry_version);
   INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
 
   // If any of the pipelines in the cache failed to create, it's likely because of a change of
@@ -331,7 +361,7 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
                  filename);
     disk_cache.Close();
     File::Delete(filename);
-    disk_cache.OpenAndRead(filename, reader);
+    disk_cache.OpenAndRead(filename, reader, entry_version);
   }
 }
 
@@ -430,6 +460,41 @@ void ShaderCache::CompileMissingPipelines()
   }
 }
 
+void ShaderCache::QueueSharedPipelines()
+{
+  // Without worker threads, this would hold up boot for the whole time budget.
+  if (!m_async_shader_compiler->HasWorkerThreads())
+    return;
+
+  const std::vector<SerializedGXPipelineUid> uids = PipelineUIDCorpus::GetSharedPipelineUIDs(
+      File::GetUserPath(D_CACHE_IDX), SConfig::GetInstance().GetGameID(),
+      static_cast<size_t>(std::max(g_ActiveConfig.iSharedPipelinePrecompileLimit, 0)));
+  m_shared_pipeline_deadline = std::chrono::steady_clock::now() +
+                               std::chrono::seconds(g_ActiveConfig.iSharedPipelinePrecompileTime);
+
+  size_t num_queued = 0;
+  for (const SerializedGXPipelineUid& serialized_uid : uids)
+  {
+    GXPipelineUid uid;
+    UnserializePipelineUid(serialized_uid, uid);
+    if (m_gx_pipeline_cache.contains(uid))
+      continue;
+
+    QueuePipelineCompile(uid, COMPILE_PRIORITY_SHARED_PIPELINE);
+    m_gx_pipeline_cache[uid].shared = true;
+    num_queued++;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Queued {} shared pipelines for compiling", num_queued);
+}
+
+void ShaderCache::RecordSharedPipelineUse(const GXPipelineUid& uid, GXPipelineCacheEntry& entry)
+{
+  // Once this title uses a shared pipeline, it belongs in the title's own UID cache.
+  entry.shared = false;
+  AppendGXPipelineUID(uid);
+}
+
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
   const ShaderCode source_code =
@@ -922,7 +987,7 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
+  constexpr u32 CACHE_FILE_MAGIC = GX_PIPELINE_UID_CACHE_MAGIC;
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
@@ -1153,10 +1218,17 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     {
       // Check if all the stages required for this pipeline have been compiled.
       // If not, this work item becomes a no-op, and re-queues the pipeline for the next frame.
-      if (SetStagesReady())
+      if (!IsExpired() && SetStagesReady())
         config = shader_cache->GetGXPipelineConfig(uid);
     }
 
+    // Shared pipelines are speculative, and are not worth compiling past the deadline.
+    bool IsExpired() const
+    {
+      return priority == COMPILE_PRIORITY_SHARED_PIPELINE &&
+             std::chrono::steady_clock::now() >= shader_cache->m_shared_pipeline_deadline.load();
+    }
+
     bool SetStagesReady()
     {
       stages_ready = true;
@@ -1181,14 +1253,32 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
     bool Compile() override
     {
-      if (config)
+      if (config && !IsExpired())
         pipeline = g_gfx->CreatePipeline(*config);
       return true;
     }
 
     void Retrieve() override
     {
-      if (stages_ready)
+      if (!pipeline && IsExpired())
+      {
+        auto& cache = shader_cache->m_gx_pipeline_cache;
+        auto it = cache.find(uid);
+        if (it == cache.end())
+          return;
+
+        if (it->second.shared)
+        {
+          // Leave it to be compiled on demand if the title turns out to need it.
+          cache.erase(it);
+        }
+        else if (it->second.second)
+        {
+          // The title asked for it while it was queued, so it is still waiting for it.
+          shader_cache->QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+        }
+      }
+      else if (stages_ready)
       {
         shader_cache->InsertGXPipeline(uid, std::move(pipeline));
       }
@@ -1207,7 +1297,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     GXPipelineUid uid;
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
-    bool stages_ready;
+    bool stages_ready = false;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
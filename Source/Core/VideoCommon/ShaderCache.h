@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <map>
@@ -123,6 +125,9 @@ private:
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
+  void QueueSharedPipelines();
+  struct GXPipelineCacheEntry;
+  void RecordSharedPipelineUse(const GXPipelineUid& uid, GXPipelineCacheEntry& entry);
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
 
@@ -184,12 +189,14 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Pipelines from the shared
+  // corpus were only used by other titles, so they come after everything this title has used.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
+    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300,
+    COMPILE_PRIORITY_SHARED_PIPELINE = 400
   };
 
   // Configuration bits.
@@ -225,13 +232,22 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
+  struct GXPipelineCacheEntry : std::pair<std::unique_ptr<AbstractPipeline>, bool>
+  {
+    // Precompiled from the shared UID corpus, and not used by this title yet. Such pipelines are
+    // kept out of the title's UID cache until it does, and are not compiled past the deadline.
+    bool shared = false;
+  };
+  std::map<GXPipelineUid, GXPipelineCacheEntry> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
+  // Shared pipelines which are still queued at this point are dropped.
+  std::atomic<std::chrono::steady_clock::time_point> m_shared_pipeline_deadline;
+
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
       m_efb_copy_to_vram_pipelines;
@@ -183,6 +183,11 @@ union ShaderHostConfig
   static ShaderHostConfig GetCurrent();
 };
 
+// Stored in the disk shader and pipeline caches in place of the build's revision. This version
+// number must be incremented whenever a change to the shader generators alters the code generated
+// for an existing UID, otherwise stale shaders will be loaded from the caches.
+constexpr u32 DISK_SHADER_CACHE_VERSION = 1;
+
 // Gets the filename of the specified type of cache object (e.g. vertex shader, pipeline).
 std::string GetDiskShaderCacheFileName(APIType api_type, const char* type, bool include_gameid,
                                        bool include_host_config, bool include_api = true);
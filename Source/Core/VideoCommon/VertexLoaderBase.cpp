@@ -21,6 +21,7 @@
 
 #include "VideoCommon/VertexLoader.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoaderSpecialized.h"
 #include "VideoCommon/VertexLoader_Color.h"
 #include "VideoCommon/VertexLoader_Normal.h"
 #include "VideoCommon/VertexLoader_Position.h"
@@ -236,6 +237,16 @@ u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& v
   return components;
 }
 
+static std::unique_ptr<VertexLoaderBase> CreateSoftwareVertexLoader(const TVtxDesc& vtx_desc,
+                                                                    const VAT& vtx_attr)
+{
+  // Common formats have variants with everything resolved at compile time, which avoid the
+  // per-attribute function calls of the generic pipeline
+  if (auto loader = VertexLoaderSpecialized::Create(vtx_desc, vtx_attr))
+    return loader;
+  return std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+}
+
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                                        const VAT& vtx_attr)
 {
@@ -243,7 +254,7 @@ std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVt
 
   if (loader_type == VertexLoaderType::Software)
   {
-    return std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+    return CreateSoftwareVertexLoader(vtx_desc, vtx_attr);
   }
 
   std::unique_ptr<VertexLoaderBase> native_loader = nullptr;
@@ -260,7 +271,7 @@ std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVt
   // then this fallback would be used)
   if (!native_loader)
   {
-    return std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+    return CreateSoftwareVertexLoader(vtx_desc, vtx_attr);
   }
 
   if (loader_type == VertexLoaderType::Compare)
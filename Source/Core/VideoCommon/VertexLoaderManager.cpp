@@ -452,19 +452,24 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
       src += loader->m_vertex_size * max_vertices;
 
+      bool compacted = false;
       if (can_cpu_cull && !cullall)
       {
-        const bool all_culled =
-            g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
-        if (!all_culled)
+        const CPUCull::Result result =
+            g_vertex_manager->CullVertices(loader, primitive, dst.GetPointer(), num_loaded);
+        if (result != CPUCull::Result::AllCulled)
         {
           DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
           memmove(new_dst.GetPointer(), dst.GetPointer(), num_loaded * stride);
           can_cpu_cull = false;
+          compacted = result == CPUCull::Result::Compacted;
         }
       }
 
-      g_vertex_manager->AddIndices(primitive, num_loaded);
+      if (compacted)
+        g_vertex_manager->AddCompactedIndices(num_loaded);
+      else
+        g_vertex_manager->AddIndices(primitive, num_loaded);
       g_vertex_manager->FlushData(num_loaded, stride);
 
       ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
@@ -0,0 +1,395 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexLoaderSpecialized.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+#include "Common/Inline.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/VertexLoader.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace
+{
+using VCF = VertexComponentFormat;
+using FMT = ComponentFormat;
+using CF = ColorFormat;
+
+// The subset of TVtxDesc and VAT a specialized loader is compiled for. Positions are always XYZ,
+// normals always N only and texture coordinates always ST; texture matrix indices, color 1 and
+// texture coordinates 2-7 are not supported. The frac values are left out, since the loader reads
+// them from the VAT at runtime like VertexLoader does.
+struct Format
+{
+  bool pos_mtx = false;
+  VCF position = VCF::NotPresent;
+  FMT position_format = FMT::UByte;
+  VCF normal = VCF::NotPresent;
+  FMT normal_format = FMT::UByte;
+  VCF color = VCF::NotPresent;
+  CF color_format = CF::RGB565;
+  VCF tex0 = VCF::NotPresent;
+  FMT tex0_format = FMT::UByte;
+  VCF tex1 = VCF::NotPresent;
+  FMT tex1_format = FMT::UByte;
+
+  constexpr bool operator==(const Format&) const = default;
+};
+
+std::optional<Format> GetFormat(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+  if (vtx_desc.low.Color1 != VCF::NotPresent || vtx_attr.g0.PosElements != CoordComponentCount::XYZ)
+    return std::nullopt;
+  for (auto texmtxidx : vtx_desc.low.TexMatIdx)
+  {
+    if (texmtxidx)
+      return std::nullopt;
+  }
+  for (size_t i = 2; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    if (vtx_desc.high.TexCoord[i] != VCF::NotPresent)
+      return std::nullopt;
+  }
+
+  Format format;
+  format.pos_mtx = vtx_desc.low.PosMatIdx;
+  format.position = vtx_desc.low.Position;
+  format.position_format = vtx_attr.g0.PosFormat;
+  if (vtx_desc.low.Normal != VCF::NotPresent)
+  {
+    if (vtx_attr.g0.NormalElements != NormalComponentCount::N)
+      return std::nullopt;
+    format.normal = vtx_desc.low.Normal;
+    format.normal_format = vtx_attr.g0.NormalFormat;
+  }
+  if (vtx_desc.low.Color0 != VCF::NotPresent)
+  {
+    format.color = vtx_desc.low.Color0;
+    format.color_format = vtx_attr.g0.Color0Comp;
+  }
+  if (vtx_desc.high.Tex0Coord != VCF::NotPresent)
+  {
+    if (vtx_attr.g0.Tex0CoordElements != TexComponentCount::ST)
+      return std::nullopt;
+    format.tex0 = vtx_desc.high.Tex0Coord;
+    format.tex0_format = vtx_attr.g0.Tex0CoordFormat;
+  }
+  if (vtx_desc.high.Tex1Coord != VCF::NotPresent)
+  {
+    if (vtx_attr.g1.Tex1CoordElements != TexComponentCount::ST)
+      return std::nullopt;
+    format.tex1 = vtx_desc.high.Tex1Coord;
+    format.tex1_format = vtx_attr.g1.Tex1CoordFormat;
+  }
+  return format;
+}
+
+template <FMT format>
+using ComponentType = std::conditional_t<
+    format == FMT::UByte, u8,
+    std::conditional_t<format == FMT::Byte, s8,
+                       std::conditional_t<format == FMT::UShort, u16,
+                                          std::conditional_t<format == FMT::Short, s16, float>>>>;
+
+template <VCF type>
+using IndexType = std::conditional_t<type == VCF::Index8, u8, u16>;
+
+template <typename T>
+DOLPHIN_FORCE_INLINE T Read(const u8* src)
+{
+  T value;
+  std::memcpy(&value, src, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+template <typename T>
+DOLPHIN_FORCE_INLINE void Write(u8*& dst, T value)
+{
+  std::memcpy(dst, &value, sizeof(T));
+  dst += sizeof(T);
+}
+
+// Returns where the attribute's data is, advancing src past the data or the index
+template <VCF type>
+DOLPHIN_FORCE_INLINE const u8* GetAttributeData(const u8*& src, CPArray array, u32 direct_size)
+{
+  if constexpr (type == VCF::Direct)
+  {
+    const u8* data = src;
+    src += direct_size;
+    return data;
+  }
+  else
+  {
+    const auto index = Read<IndexType<type>>(src);
+    src += sizeof(IndexType<type>);
+    return VertexLoaderManager::cached_arraybases[array] +
+           index * g_main_cp_state.array_strides[array];
+  }
+}
+
+template <typename T>
+DOLPHIN_FORCE_INLINE float Scale(T value, float scale)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return value;
+  else
+    return value * scale;
+}
+
+// Same as FracAdjust in VertexLoader_Normal.cpp
+template <typename T>
+DOLPHIN_FORCE_INLINE float NormalScale(T value)
+{
+  if constexpr (std::is_same_v<T, float>)
+    return value;
+  else
+    return value / float(1u << (sizeof(T) * 8 - std::is_signed_v<T> - 1));
+}
+
+constexpr u32 GetColorSize(CF format)
+{
+  switch (format)
+  {
+  case CF::RGB565:
+  case CF::RGBA4444:
+    return 2;
+  case CF::RGB888:
+  case CF::RGBA6666:
+    return 3;
+  default:
+    return 4;
+  }
+}
+
+// Same conversions as VertexLoader_Color.cpp
+template <CF format>
+DOLPHIN_FORCE_INLINE u32 ReadColor(const u8* data)
+{
+  constexpr u32 alpha_mask = 0xFF000000;
+
+  if constexpr (format == CF::RGB565)
+  {
+    const u32 val = Read<u16>(data);
+    u32 col = (val >> 8) & 0x0000F8;
+    col |= (val << 5) & 0x00FC00;
+    col |= (val << 19) & 0xF80000;
+    col |= (col >> 5) & 0x070007;
+    col |= (col >> 6) & 0x000300;
+    return col | alpha_mask;
+  }
+  else if constexpr (format == CF::RGB888 || format == CF::RGB888x)
+  {
+    u32 col;
+    std::memcpy(&col, data, sizeof(u32));
+    return col | alpha_mask;
+  }
+  else if constexpr (format == CF::RGBA4444)
+  {
+    u16 raw;
+    std::memcpy(&raw, data, sizeof(u16));
+    const u32 val = raw;
+    u32 col = val & 0x00F0;
+    col |= (val & 0x000F) << 12;
+    col |= (val & 0xF000) << 8;
+    col |= (val & 0x0F00) << 20;
+    return col | (col >> 4);
+  }
+  else if constexpr (format == CF::RGBA6666)
+  {
+    const u32 val = Common::swap24(data);
+    u32 col = (val >> 16) & 0x000000FC;
+    col |= (val >> 2) & 0x0000FC00;
+    col |= (val << 12) & 0x00FC0000;
+    col |= (val << 26) & 0xFC000000;
+    return col | ((col >> 6) & 0x03030303);
+  }
+  else
+  {
+    u32 col;
+    std::memcpy(&col, data, sizeof(u32));
+    return col;
+  }
+}
+
+template <VCF type, FMT format>
+DOLPHIN_FORCE_INLINE void LoadTexCoord(const u8*& src, u8*& dst, CPArray array, float scale)
+{
+  using T = ComponentType<format>;
+  const u8* data = GetAttributeData<type>(src, array, 2 * sizeof(T));
+  Write(dst, Scale(Read<T>(data), scale));
+  Write(dst, Scale(Read<T>(data + sizeof(T)), scale));
+}
+
+// Derives from VertexLoader only to share the native vertex declaration and the frac scales it
+// computes; the pipeline it builds is never run.
+template <Format F>
+class SpecializedVertexLoader final : public VertexLoader
+{
+public:
+  SpecializedVertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+      : VertexLoader(vtx_desc, vtx_attr)
+  {
+  }
+
+  int RunVertices(const u8* src, u8* dst, int count) override
+  {
+    using PosType = ComponentType<F.position_format>;
+    using NormalType = ComponentType<F.normal_format>;
+
+    const u32 stride = m_native_vtx_decl.stride;
+    const float pos_scale = m_posScale;
+    const float tex0_scale = m_tcScale[0];
+    const float tex1_scale = m_tcScale[1];
+    int skipped = 0;
+
+    m_numLoadedVertices += count;
+
+    for (int remaining = count - 1; remaining >= 0; remaining--)
+    {
+      if constexpr (F.pos_mtx)
+      {
+        const u32 posmtx = *src++ & 0x3f;
+        if (remaining < 3)
+          VertexLoaderManager::position_matrix_index_cache[remaining] = posmtx;
+        Write(dst, posmtx);
+      }
+
+      // An index of all ones for an indexed position skips the vertex
+      bool skip = false;
+      if constexpr (IsIndexed(F.position))
+      {
+        skip = Read<IndexType<F.position>>(src) ==
+               std::numeric_limits<IndexType<F.position>>::max();
+      }
+      const u8* pos = GetAttributeData<F.position>(src, CPArray::Position, 3 * sizeof(PosType));
+      for (int i = 0; i < 3; i++)
+      {
+        const float value = Scale(Read<PosType>(pos + i * sizeof(PosType)), pos_scale);
+        if (remaining < 3 && !skip)
+          VertexLoaderManager::position_cache[remaining][i] = value;
+        Write(dst, value);
+      }
+
+      if constexpr (F.normal != VCF::NotPresent)
+      {
+        const u8* normal =
+            GetAttributeData<F.normal>(src, CPArray::Normal, 3 * sizeof(NormalType));
+        for (int i = 0; i < 3; i++)
+        {
+          const float value = NormalScale(Read<NormalType>(normal + i * sizeof(NormalType)));
+          if (remaining == 0)
+            VertexLoaderManager::normal_cache[i] = value;
+          Write(dst, value);
+        }
+      }
+
+      if constexpr (F.color != VCF::NotPresent)
+      {
+        const u8* color =
+            GetAttributeData<F.color>(src, CPArray::Color0, GetColorSize(F.color_format));
+        Write(dst, ReadColor<F.color_format>(color));
+      }
+
+      if constexpr (F.tex0 != VCF::NotPresent)
+        LoadTexCoord<F.tex0, F.tex0_format>(src, dst, CPArray::TexCoord0, tex0_scale);
+      if constexpr (F.tex1 != VCF::NotPresent)
+        LoadTexCoord<F.tex1, F.tex1_format>(src, dst, CPArray::TexCoord1, tex1_scale);
+
+      if (skip)
+      {
+        dst -= stride;
+        skipped++;
+      }
+    }
+
+    return count - skipped;
+  }
+};
+
+// Formats seen most often in commercial games. Direct formats are mostly used for 2D elements
+// and UI, indexed formats for models.
+constexpr std::array s_formats = {
+    // Direct
+    Format{.position = VCF::Direct, .position_format = FMT::Float, .color = VCF::Direct,
+           .color_format = CF::RGBA8888},
+    Format{.position = VCF::Direct, .position_format = FMT::Float, .tex0 = VCF::Direct,
+           .tex0_format = FMT::Float},
+    Format{.position = VCF::Direct, .position_format = FMT::Float, .color = VCF::Direct,
+           .color_format = CF::RGBA8888, .tex0 = VCF::Direct, .tex0_format = FMT::Float},
+    Format{.position = VCF::Direct, .position_format = FMT::Short, .tex0 = VCF::Direct,
+           .tex0_format = FMT::Short},
+    Format{.position = VCF::Direct, .position_format = FMT::Short, .color = VCF::Direct,
+           .color_format = CF::RGBA8888, .tex0 = VCF::Direct, .tex0_format = FMT::Short},
+    Format{.position = VCF::Direct, .position_format = FMT::Float, .normal = VCF::Direct,
+           .normal_format = FMT::Float, .tex0 = VCF::Direct, .tex0_format = FMT::Float},
+
+    // Indexed
+    Format{.position = VCF::Index16, .position_format = FMT::Float, .normal = VCF::Index16,
+           .normal_format = FMT::Short, .tex0 = VCF::Index16, .tex0_format = FMT::UShort,
+           .tex1 = VCF::Index16, .tex1_format = FMT::Float},
+    Format{.position = VCF::Index16, .position_format = FMT::Float, .normal = VCF::Index16,
+           .normal_format = FMT::Float, .tex0 = VCF::Index16, .tex0_format = FMT::Float},
+    Format{.pos_mtx = true, .position = VCF::Index16, .position_format = FMT::Float,
+           .normal = VCF::Index16, .normal_format = FMT::Float, .tex0 = VCF::Index16,
+           .tex0_format = FMT::Float},
+    Format{.position = VCF::Index16, .position_format = FMT::Short, .normal = VCF::Index16,
+           .normal_format = FMT::Byte, .tex0 = VCF::Index16, .tex0_format = FMT::Short},
+    Format{.pos_mtx = true, .position = VCF::Index16, .position_format = FMT::Short,
+           .normal = VCF::Index16, .normal_format = FMT::Byte, .tex0 = VCF::Index16,
+           .tex0_format = FMT::Short},
+    Format{.position = VCF::Index16, .position_format = FMT::Short, .normal = VCF::Index16,
+           .normal_format = FMT::Short, .tex0 = VCF::Index16, .tex0_format = FMT::Short},
+    Format{.pos_mtx = true, .position = VCF::Index16, .position_format = FMT::Short,
+           .normal = VCF::Index16, .normal_format = FMT::Short, .tex0 = VCF::Index16,
+           .tex0_format = FMT::Short},
+    Format{.position = VCF::Index16, .position_format = FMT::Short, .color = VCF::Index16,
+           .color_format = CF::RGBA8888, .tex0 = VCF::Index16, .tex0_format = FMT::Short},
+    Format{.position = VCF::Index16, .position_format = FMT::Float, .normal = VCF::Index16,
+           .normal_format = FMT::Byte, .color = VCF::Index16, .color_format = CF::RGBA8888,
+           .tex0 = VCF::Index16, .tex0_format = FMT::Float},
+    Format{.position = VCF::Index8, .position_format = FMT::Short, .normal = VCF::Index8,
+           .normal_format = FMT::Byte, .tex0 = VCF::Index8, .tex0_format = FMT::Short},
+};
+
+using Factory = std::unique_ptr<VertexLoaderBase> (*)(const TVtxDesc&, const VAT&);
+
+template <Format F>
+std::unique_ptr<VertexLoaderBase> Construct(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+  return std::make_unique<SpecializedVertexLoader<F>>(vtx_desc, vtx_attr);
+}
+
+template <size_t... I>
+constexpr std::array<Factory, sizeof...(I)> MakeFactories(std::index_sequence<I...>)
+{
+  return {Construct<s_formats[I]>...};
+}
+
+constexpr auto s_factories = MakeFactories(std::make_index_sequence<s_formats.size()>());
+}  // Anonymous namespace
+
+namespace VertexLoaderSpecialized
+{
+std::unique_ptr<VertexLoaderBase> Create(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+  const std::optional<Format> format = GetFormat(vtx_desc, vtx_attr);
+  if (!format)
+    return nullptr;
+
+  for (size_t i = 0; i < s_formats.size(); i++)
+  {
+    if (s_formats[i] == *format)
+      return s_factories[i](vtx_desc, vtx_attr);
+  }
+  return nullptr;
+}
+}  // namespace VertexLoaderSpecialized
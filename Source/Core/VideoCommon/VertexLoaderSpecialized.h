@@ -0,0 +1,19 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+// Variants of the software VertexLoader with the whole vertex format fixed at compile time.
+// Instead of calling one pipeline function per attribute per vertex, each of these decodes a
+// vertex in a single inlined loop body. They only exist for a curated list of commonly used
+// formats; everything else goes through the generic pipeline.
+namespace VertexLoaderSpecialized
+{
+// Returns nullptr if there is no specialized loader for this vertex format.
+std::unique_ptr<VertexLoaderBase> Create(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+}  // namespace VertexLoaderSpecialized
@@ -139,11 +139,16 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
-bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
-                                             OpcodeDecoder::Primitive primitive, const u8* src,
-                                             u32 count)
+void VertexManagerBase::AddCompactedIndices(u32 num_vertices)
 {
-  return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
+  m_index_generator.AddTriangleIndices(m_cpu_cull.GetCompactedIndices(), num_vertices);
+}
+
+CPUCull::Result VertexManagerBase::CullVertices(VertexLoaderBase* loader,
+                                                OpcodeDecoder::Primitive primitive, const u8* src,
+                                                u32 count)
+{
+  return m_cpu_cull.CullVertices(loader, primitive, src, count);
 }
 
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
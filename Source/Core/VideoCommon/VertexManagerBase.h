@@ -108,8 +108,11 @@ public:
 
   PrimitiveType GetCurrentPrimitiveType() const { return m_current_primitive_type; }
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+  /// Adds the triangles which survived the last CullVertices call that returned
+  /// CPUCull::Result::Compacted, in place of AddIndices
+  void AddCompactedIndices(u32 num_vertices);
+  CPUCull::Result CullVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                               const u8* src, u32 count);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -150,6 +150,9 @@ void VideoConfig::Refresh()
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  bPrecompileSharedPipelines = Config::Get(Config::GFX_PRECOMPILE_SHARED_PIPELINES);
+  iSharedPipelinePrecompileLimit = Config::Get(Config::GFX_SHARED_PIPELINE_PRECOMPILE_LIMIT);
+  iSharedPipelinePrecompileTime = Config::Get(Config::GFX_SHARED_PIPELINE_PRECOMPILE_TIME);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
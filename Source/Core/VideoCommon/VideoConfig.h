@@ -283,6 +283,13 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Precompile pipelines which other titles have used, from the shared pipeline UID corpus.
+  // The limit bounds the number of pipelines created, the time (in seconds) how long after boot
+  // they are still compiled.
+  bool bPrecompileSharedPipelines = false;
+  int iSharedPipelinePrecompileLimit = 0;
+  int iSharedPipelinePrecompileTime = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
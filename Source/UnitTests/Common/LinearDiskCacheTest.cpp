@@ -0,0 +1,215 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+struct Key
+{
+  u32 a;
+  u32 b;
+};
+
+using Cache = Common::LinearDiskCache<Key, u8>;
+
+class Reader : public Common::LinearDiskCacheReader<Key, u8>
+{
+public:
+  void Read(const Key& key, const u8* value, u32 value_size) override
+  {
+    values[key.a] = std::vector<u8>(value, value + value_size);
+  }
+
+  std::map<u32, std::vector<u8>> values;
+};
+
+std::vector<u8> MakeValue(u32 seed, u32 size)
+{
+  std::vector<u8> value(size);
+  for (u32 i = 0; i < size; i++)
+    value[i] = static_cast<u8>(seed * 31 + i);
+  return value;
+}
+
+void Append(Cache& cache, u32 key, const std::vector<u8>& value)
+{
+  cache.Append(Key{key, ~key}, value.data(), static_cast<u32>(value.size()));
+}
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_parent_directory(File::CreateTempDir()), m_file_path(m_parent_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  // Fills a new cache with values of increasing size for keys 0 to count - 1
+  void CreateCache(u32 count)
+  {
+    Cache cache;
+    Reader reader;
+    EXPECT_EQ(0u, cache.OpenAndRead(m_file_path, reader, 1));
+    for (u32 i = 0; i < count; i++)
+      Append(cache, i, MakeValue(i, i * 10));
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_file_path;
+};
+
+TEST_F(LinearDiskCacheTest, RoundTrip)
+{
+  CreateCache(20);
+
+  Cache cache;
+  Reader reader;
+  EXPECT_EQ(20u, cache.OpenAndRead(m_file_path, reader, 1));
+  ASSERT_EQ(20u, reader.values.size());
+  for (u32 i = 0; i < 20; i++)
+    EXPECT_EQ(MakeValue(i, i * 10), reader.values[i]);
+}
+
+TEST_F(LinearDiskCacheTest, Find)
+{
+  CreateCache(20);
+
+  Cache cache;
+  EXPECT_TRUE(cache.Open(m_file_path, 1));
+  const auto value = cache.Find(Key{7, ~7u});
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(MakeValue(7, 70), std::vector<u8>(value->begin(), value->end()));
+  EXPECT_FALSE(cache.Find(Key{7, 7}).has_value());
+  EXPECT_FALSE(cache.Find(Key{20, ~20u}).has_value());
+
+  // Entries appended after opening are indexed, but not mapped
+  Append(cache, 20, MakeValue(20, 5));
+  EXPECT_TRUE(cache.Contains(Key{20, ~20u}));
+  EXPECT_FALSE(cache.Find(Key{20, ~20u}).has_value());
+}
+
+TEST_F(LinearDiskCacheTest, EntryVersionMismatchDiscards)
+{
+  CreateCache(5);
+
+  Cache cache;
+  Reader reader;
+  EXPECT_EQ(0u, cache.OpenAndRead(m_file_path, reader, 2));
+  cache.Close();
+  EXPECT_EQ(0u, cache.OpenAndRead(m_file_path, reader, 1));
+  EXPECT_TRUE(reader.values.empty());
+}
+
+TEST_F(LinearDiskCacheTest, LatestValueWins)
+{
+  CreateCache(10);
+  {
+    Cache cache;
+    Reader reader;
+    EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+    Append(cache, 3, MakeValue(100, 3));
+  }
+
+  Cache cache;
+  Reader reader;
+  EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+  EXPECT_EQ(MakeValue(100, 3), reader.values[3]);
+}
+
+TEST_F(LinearDiskCacheTest, IdenticalAppendIsSkipped)
+{
+  CreateCache(10);
+  const u64 size = File::GetSize(m_file_path);
+  {
+    Cache cache;
+    Reader reader;
+    EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+    Append(cache, 4, MakeValue(4, 40));
+  }
+  EXPECT_EQ(size, File::GetSize(m_file_path));
+}
+
+TEST_F(LinearDiskCacheTest, CompactsSupersededEntries)
+{
+  CreateCache(10);
+  const u64 size = File::GetSize(m_file_path);
+
+  // Supersede every entry a few times
+  for (u32 pass = 1; pass <= 3; pass++)
+  {
+    Cache cache;
+    Reader reader;
+    EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+    for (u32 i = 0; i < 10; i++)
+      Append(cache, i, MakeValue(i + pass, i * 10));
+  }
+
+  Cache cache;
+  Reader reader;
+  EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+  cache.Close();
+  EXPECT_EQ(size, File::GetSize(m_file_path));
+  for (u32 i = 0; i < 10; i++)
+    EXPECT_EQ(MakeValue(i + 3, i * 10), reader.values[i]);
+}
+
+TEST_F(LinearDiskCacheTest, RecoversFromTornWrite)
+{
+  CreateCache(10);
+  {
+    // Simulate a crash while writing the last entry, before any index was written
+    Cache cache;
+    Reader reader;
+    EXPECT_EQ(10u, cache.OpenAndRead(m_file_path, reader, 1));
+    Append(cache, 10, MakeValue(10, 100));
+    Append(cache, 11, MakeValue(11, 100));
+    cache.Sync();
+    File::IOFile file(m_file_path, "r+b");
+    file.Resize(file.GetSize() - 50);
+    file.Close();
+    File::IOFile(m_file_path, "ab").WriteBytes("garbage", 7);
+
+    // Keep the cache from writing its index on close
+    File::Copy(m_file_path, m_file_path + ".torn");
+  }
+  File::Rename(m_file_path + ".torn", m_file_path);
+
+  Cache cache;
+  Reader reader;
+  EXPECT_EQ(11u, cache.OpenAndRead(m_file_path, reader, 1));
+  EXPECT_EQ(MakeValue(10, 100), reader.values[10]);
+  EXPECT_FALSE(reader.values.contains(11));
+
+  // New entries go after the last complete one. They overwrite the mapped garbage, which must not
+  // be returned for them.
+  Append(cache, 11, MakeValue(11, 7));
+  EXPECT_TRUE(cache.Contains(Key{11, ~11u}));
+  EXPECT_FALSE(cache.Find(Key{11, ~11u}).has_value());
+  cache.Close();
+  reader.values.clear();
+  EXPECT_EQ(12u, cache.OpenAndRead(m_file_path, reader, 1));
+  EXPECT_EQ(MakeValue(11, 7), reader.values[11]);
+}
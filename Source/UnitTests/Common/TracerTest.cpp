@@ -0,0 +1,135 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Thread.h"
+#include "Common/Tracer.h"
+
+namespace
+{
+size_t CountOccurrences(const std::string& haystack, const std::string& needle)
+{
+  size_t count = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + needle.size()))
+  {
+    count++;
+  }
+  return count;
+}
+
+// Returns the thread ID of the first event with the given name.
+std::string GetThreadID(const std::string& trace, const std::string& name)
+{
+  const size_t event = trace.find(R"("name":")" + name + '"');
+  const size_t tid = trace.find(R"("tid":)", event);
+  if (event == std::string::npos || tid == std::string::npos)
+    return {};
+  return trace.substr(tid + 6, trace.find('}', tid) - tid - 6);
+}
+
+std::string WriteTrace()
+{
+  const std::string dir = File::CreateTempDir();
+  const std::string path = dir + "/trace.json";
+  EXPECT_TRUE(Common::Tracer::StopAndWrite(path));
+  std::string contents;
+  EXPECT_TRUE(File::ReadFileToString(path, contents));
+  File::DeleteDirRecursively(dir);
+  return contents;
+}
+}  // namespace
+
+TEST(Tracer, DisabledByDefault)
+{
+  EXPECT_FALSE(Common::Tracer::IsEnabled());
+  {
+    Common::Tracer::ScopedEvent trace("Ignored", "Test");
+  }
+
+  Common::Tracer::Start();
+  EXPECT_TRUE(Common::Tracer::IsEnabled());
+  const std::string trace = WriteTrace();
+  EXPECT_FALSE(Common::Tracer::IsEnabled());
+  EXPECT_EQ(std::string::npos, trace.find("Ignored"));
+}
+
+TEST(Tracer, RecordsEventsFromAllThreads)
+{
+  constexpr int NUM_THREADS = 4;
+  constexpr int EVENTS_PER_THREAD = 1000;
+
+  Common::Tracer::Start();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < NUM_THREADS; i++)
+  {
+    threads.emplace_back([i] {
+      Common::SetCurrentThreadName(("Tracer \"worker\" " + std::to_string(i)).c_str());
+      for (int j = 0; j < EVENTS_PER_THREAD; j++)
+        Common::Tracer::ScopedEvent trace("Work", "Test");
+      Common::Tracer::Instant(Common::Tracer::InternName("Done"), "Test");
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  const std::string trace = WriteTrace();
+  EXPECT_TRUE(trace.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+  EXPECT_TRUE(trace.ends_with("]}\n"));
+  EXPECT_EQ(size_t{NUM_THREADS * EVENTS_PER_THREAD},
+            CountOccurrences(trace, R"("name":"Work","cat":"Test","ph":"X")"));
+  EXPECT_EQ(size_t{NUM_THREADS}, CountOccurrences(trace, R"("name":"Done","cat":"Test","ph":"i")"));
+  for (int i = 0; i < NUM_THREADS; i++)
+  {
+    EXPECT_NE(std::string::npos,
+              trace.find(R"("args":{"name":"Tracer \"worker\" )" + std::to_string(i) + "\"}"));
+  }
+}
+
+TEST(Tracer, StartDiscardsPreviousTrace)
+{
+  Common::Tracer::Start();
+  {
+    Common::Tracer::ScopedEvent trace("First", "Test");
+  }
+  WriteTrace();
+
+  Common::Tracer::Start();
+  {
+    Common::Tracer::ScopedEvent trace("Second", "Test");
+  }
+  const std::string trace = WriteTrace();
+  EXPECT_EQ(std::string::npos, trace.find("First"));
+  EXPECT_EQ(1u, CountOccurrences(trace, "\"Second\""));
+}
+
+TEST(Tracer, ReusesBuffersOfExitedThreads)
+{
+  const auto record_on_thread = [](const char* name) {
+    std::thread([name] { Common::Tracer::Instant(name, "Test"); }).join();
+  };
+
+  // Within a trace, the events of exited threads are kept
+  Common::Tracer::Start();
+  record_on_thread("First");
+  record_on_thread("Second");
+  std::string trace = WriteTrace();
+  const std::string first_id = GetThreadID(trace, "First");
+  ASSERT_FALSE(first_id.empty());
+  EXPECT_NE(first_id, GetThreadID(trace, "Second"));
+
+  // Once they have been written out, the next threads get their buffers
+  for (int i = 0; i < 3; i++)
+  {
+    Common::Tracer::Start();
+    record_on_thread("Later");
+    trace = WriteTrace();
+    EXPECT_EQ(first_id, GetThreadID(trace, "Later"));
+  }
+}
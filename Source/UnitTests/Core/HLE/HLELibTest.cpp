@@ -0,0 +1,390 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Common/Assembler/GekkoAssembler.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HLE/HLE.h"
+#include "Core/HLE/HLE_Lib.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Checks the native replacements against straightforward implementations of the routines they
+// replace, running on the interpreter.
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00010000;
+constexpr u32 STOP_ADDRESS = 0x00008000;
+constexpr u32 DATA_ADDRESS = 0x00100000;
+// Spans a page boundary, to cover the page translation of the replacements.
+constexpr u32 DATA_SIZE = 0x2000;
+constexpr int MAX_STEPS = 1000000;
+
+constexpr std::string_view MEMMOVE = R"(
+  cmplwi r5, 0
+  beqlr
+  cmplw r4, r3
+  blt backward
+  addi r4, r4, -1
+  addi r6, r3, -1
+  mtctr r5
+forward:
+  lbzu r0, 1(r4)
+  stbu r0, 1(r6)
+  bdnz forward
+  blr
+backward:
+  add r4, r4, r5
+  add r6, r3, r5
+  mtctr r5
+backward_loop:
+  lbzu r0, -1(r4)
+  stbu r0, -1(r6)
+  bdnz backward_loop
+  blr
+)";
+
+constexpr std::string_view MEMSET = R"(
+  cmplwi r5, 0
+  beqlr
+  addi r6, r3, -1
+  mtctr r5
+loop:
+  stbu r4, 1(r6)
+  bdnz loop
+  blr
+)";
+
+constexpr std::string_view STRLEN = R"(
+  addi r4, r3, -1
+loop:
+  lbzu r0, 1(r4)
+  cmpwi r0, 0
+  bne loop
+  subf r3, r3, r4
+  blr
+)";
+
+constexpr std::string_view STRCMP = R"(
+  addi r3, r3, -1
+  addi r4, r4, -1
+loop:
+  lbzu r5, 1(r3)
+  lbzu r6, 1(r4)
+  subf. r0, r6, r5
+  bne done
+  cmpwi r5, 0
+  bne loop
+done:
+  mr r3, r0
+  blr
+)";
+
+constexpr std::string_view STRCPY = R"(
+  addi r4, r4, -1
+  addi r5, r3, -1
+loop:
+  lbzu r0, 1(r4)
+  stbu r0, 1(r5)
+  cmpwi r0, 0
+  bne loop
+  blr
+)";
+
+constexpr std::string_view PSMTXIDENTITY = R"(
+  lis r4, 0x3f80
+  li r5, 0
+  stw r4, 0(r3)
+  stw r5, 4(r3)
+  stw r5, 8(r3)
+  stw r5, 12(r3)
+  stw r5, 16(r3)
+  stw r4, 20(r3)
+  stw r5, 24(r3)
+  stw r5, 28(r3)
+  stw r5, 32(r3)
+  stw r5, 36(r3)
+  stw r4, 40(r3)
+  stw r5, 44(r3)
+  blr
+)";
+
+constexpr std::string_view PSMTXCOPY = R"(
+  li r5, 12
+  mtctr r5
+  addi r3, r3, -4
+  addi r4, r4, -4
+loop:
+  lwzu r0, 4(r3)
+  stwu r0, 4(r4)
+  bdnz loop
+  blr
+)";
+
+constexpr std::string_view PSMTXTRANS = R"(
+  lis r4, 0x3f80
+  li r5, 0
+  stw r4, 0(r3)
+  stw r5, 4(r3)
+  stw r5, 8(r3)
+  stfs f1, 12(r3)
+  stw r5, 16(r3)
+  stw r4, 20(r3)
+  stw r5, 24(r3)
+  stfs f2, 28(r3)
+  stw r5, 32(r3)
+  stw r5, 36(r3)
+  stw r4, 40(r3)
+  stfs f3, 44(r3)
+  blr
+)";
+
+constexpr std::string_view PSMTXSCALE = R"(
+  li r5, 0
+  stfs f1, 0(r3)
+  stw r5, 4(r3)
+  stw r5, 8(r3)
+  stw r5, 12(r3)
+  stw r5, 16(r3)
+  stfs f2, 20(r3)
+  stw r5, 24(r3)
+  stw r5, 28(r3)
+  stw r5, 32(r3)
+  stw r5, 36(r3)
+  stfs f3, 40(r3)
+  stw r5, 44(r3)
+  blr
+)";
+
+struct Arguments
+{
+  std::array<u32, 3> gpr{};
+  std::array<double, 3> fpr{};
+};
+
+struct Result
+{
+  u32 r3 = 0;
+  std::vector<u8> data;
+};
+
+class HLELibTest : public testing::Test
+{
+protected:
+  HLELibTest() : m_system(Core::System::GetInstance()), m_profile_path(File::CreateTempDir()) {}
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_profile_path.empty());
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    m_system.GetMemory().Init();
+    m_system.GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+    m_system.GetCoreTiming().Init();
+    m_system.GetPPCState().msr.FP = 1;
+  }
+
+  void TearDown() override
+  {
+    m_system.GetCoreTiming().Shutdown();
+    m_system.GetPowerPC().Shutdown();
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  // Fills the data area with a pattern that contains zero bytes every now and then.
+  void ResetData()
+  {
+    std::vector<u8> data(DATA_SIZE);
+    u32 state = 12345;
+    for (u8& byte : data)
+    {
+      state = state * 1103515245 + 12345;
+      byte = static_cast<u8>(state >> 24);
+    }
+    m_system.GetMemory().CopyToEmu(DATA_ADDRESS, data.data(), data.size());
+  }
+
+  void WriteString(u32 address, std::string_view str)
+  {
+    m_system.GetMemory().CopyToEmu(address, str.data(), str.size());
+    m_system.GetMemory().Write_U8(0, address + static_cast<u32>(str.size()));
+  }
+
+  void SetArguments(const Arguments& arguments)
+  {
+    auto& ppc_state = m_system.GetPPCState();
+    for (size_t i = 0; i < arguments.gpr.size(); i++)
+      ppc_state.gpr[3 + i] = arguments.gpr[i];
+    for (size_t i = 0; i < arguments.fpr.size(); i++)
+      ppc_state.ps[1 + i].SetBoth(arguments.fpr[i], arguments.fpr[i]);
+    LR(ppc_state) = STOP_ADDRESS;
+  }
+
+  Result GetResult() const
+  {
+    Result result{m_system.GetPPCState().gpr[3], std::vector<u8>(DATA_SIZE)};
+    m_system.GetMemory().CopyFromEmu(result.data.data(), DATA_ADDRESS, DATA_SIZE);
+    return result;
+  }
+
+  Result RunGuest(std::string_view assembly, const Arguments& arguments)
+  {
+    const auto blocks = Common::GekkoAssembler::Assemble(assembly, CODE_ADDRESS);
+    EXPECT_FALSE(Common::GekkoAssembler::IsFailure(blocks));
+    if (Common::GekkoAssembler::IsFailure(blocks))
+      return {};
+
+    auto& memory = m_system.GetMemory();
+    for (const auto& block : Common::GekkoAssembler::GetT(blocks))
+      memory.CopyToEmu(block.block_address, block.instructions.data(), block.instructions.size());
+
+    auto& ppc_state = m_system.GetPPCState();
+    ppc_state.iCache.Reset(m_system.GetJitInterface());
+    SetArguments(arguments);
+    ppc_state.pc = CODE_ADDRESS;
+    auto& interpreter = m_system.GetInterpreter();
+    for (int i = 0; i < MAX_STEPS && ppc_state.pc != STOP_ADDRESS; i++)
+      interpreter.SingleStepInner();
+    EXPECT_EQ(STOP_ADDRESS, ppc_state.pc);
+
+    return GetResult();
+  }
+
+  Result RunHLE(HLE::HookFunction function, const Arguments& arguments)
+  {
+    SetArguments(arguments);
+    function(Core::CPUThreadGuard{m_system});
+    EXPECT_EQ(STOP_ADDRESS, m_system.GetPPCState().npc);
+    return GetResult();
+  }
+
+  // Runs both implementations from the same initial state, and checks that they leave the same
+  // return value and memory behind.
+  void Compare(std::string_view assembly, HLE::HookFunction function, const Arguments& arguments)
+  {
+    const std::vector<u8> initial_data = GetResult().data;
+    const Result expected = RunGuest(assembly, arguments);
+    m_system.GetMemory().CopyToEmu(DATA_ADDRESS, initial_data.data(), initial_data.size());
+    const Result actual = RunHLE(function, arguments);
+
+    EXPECT_EQ(expected.r3, actual.r3);
+    EXPECT_TRUE(expected.data == actual.data);
+  }
+
+  Core::System& m_system;
+  std::string m_profile_path;
+};
+}  // namespace
+
+TEST_F(HLELibTest, Memmove)
+{
+  constexpr std::array<std::array<u32, 3>, 7> cases{{
+      {DATA_ADDRESS + 0x100, DATA_ADDRESS + 0x400, 0x80},   // Disjoint
+      {DATA_ADDRESS + 0x100, DATA_ADDRESS + 0x120, 0x80},   // Overlapping, moving down
+      {DATA_ADDRESS + 0x120, DATA_ADDRESS + 0x100, 0x80},   // Overlapping, moving up
+      {DATA_ADDRESS + 0x0F0, DATA_ADDRESS + 0x1F80, 0x33},  // Across a page boundary
+      {DATA_ADDRESS + 0x100, DATA_ADDRESS + 0x100, 0x10},   // In place
+      {DATA_ADDRESS + 0x100, DATA_ADDRESS + 0x200, 0x1},
+      {DATA_ADDRESS + 0x100, DATA_ADDRESS + 0x200, 0x0},
+  }};
+
+  for (const auto& gpr : cases)
+  {
+    ResetData();
+    Compare(MEMMOVE, HLE_Lib::HLE_memmove, {gpr});
+    ResetData();
+    Compare(MEMMOVE, HLE_Lib::HLE_memcpy, {gpr});
+  }
+}
+
+TEST_F(HLELibTest, Memset)
+{
+  constexpr std::array<std::array<u32, 3>, 4> cases{{
+      {DATA_ADDRESS + 0x101, 0xAB, 0x7F},
+      {DATA_ADDRESS + 0xF00, 0x12345600, 0x200},  // Only the low byte is used
+      {DATA_ADDRESS + 0x100, 0xFF, 0x1},
+      {DATA_ADDRESS + 0x100, 0xFF, 0x0},
+  }};
+
+  for (const auto& gpr : cases)
+  {
+    ResetData();
+    Compare(MEMSET, HLE_Lib::HLE_memset, {gpr});
+  }
+}
+
+TEST_F(HLELibTest, Strings)
+{
+  constexpr u32 STR1 = DATA_ADDRESS + 0x100;
+  constexpr u32 STR2 = DATA_ADDRESS + 0xFF8;
+  constexpr u32 DEST = DATA_ADDRESS + 0x1800;
+
+  constexpr std::array<std::pair<std::string_view, std::string_view>, 6> cases{{
+      {"", ""},
+      {"Dolphin", "Dolphin"},
+      {"Dolphin", "Dolphins"},
+      {"Dolphins", "Dolphin"},
+      {"abc", "abd"},
+      {"\x80", "\x7f"},  // Characters are compared as unsigned
+  }};
+
+  for (const auto& [str1, str2] : cases)
+  {
+    ResetData();
+    WriteString(STR1, str1);
+    WriteString(STR2, str2);
+    Compare(STRLEN, HLE_Lib::HLE_strlen, {{STR1}});
+    Compare(STRLEN, HLE_Lib::HLE_strlen, {{STR2}});
+    Compare(STRCMP, HLE_Lib::HLE_strcmp, {{STR1, STR2}});
+    Compare(STRCPY, HLE_Lib::HLE_strcpy, {{DEST, STR2}});
+  }
+}
+
+TEST_F(HLELibTest, Matrices)
+{
+  constexpr u32 SRC = DATA_ADDRESS + 0x100;
+  constexpr u32 DEST = DATA_ADDRESS + 0xFE0;
+
+  ResetData();
+  Compare(PSMTXIDENTITY, HLE_Lib::HLE_PSMTXIdentity, {{DEST}});
+  ResetData();
+  Compare(PSMTXCOPY, HLE_Lib::HLE_PSMTXCopy, {{SRC, DEST}});
+
+  constexpr std::array<std::array<double, 3>, 4> cases{{
+      {1.0, -2.5, 1024.0},
+      {0.1, -0.0, 3.4e38},     // Rounded to single precision
+      {1e-40, -1e-45, 1e-50},  // Denormal and out of range
+      {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(), 1e39},
+  }};
+
+  for (const auto& fpr : cases)
+  {
+    ResetData();
+    Compare(PSMTXTRANS, HLE_Lib::HLE_PSMTXTrans, {{DEST}, fpr});
+    ResetData();
+    Compare(PSMTXSCALE, HLE_Lib::HLE_PSMTXScale, {{DEST}, fpr});
+  }
+}
@@ -272,6 +272,60 @@ TEST_F(FileSystemTest, GetDirectoryStats)
   check_stats(1u, 2u);
 }
 
+TEST_F(FileSystemTest, GetDirectoryStatsAfterChanges)
+{
+  // Stats that were already requested before a change must match freshly computed ones.
+  // Note that a new IOS instance clears /tmp, so these tests use a different directory.
+  auto check_stats = [this](const std::string& path) {
+    const Result<DirectoryStats> stats = m_fs->GetDirectoryStats(path);
+    const Result<DirectoryStats> fresh_stats = IOS::HLE::Kernel{}.GetFS()->GetDirectoryStats(path);
+    ASSERT_TRUE(stats.Succeeded()) << path;
+    ASSERT_TRUE(fresh_stats.Succeeded()) << path;
+    EXPECT_EQ(stats->used_clusters, fresh_stats->used_clusters) << path;
+    EXPECT_EQ(stats->used_inodes, fresh_stats->used_inodes) << path;
+  };
+
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/shared2/a", 0, modes), ResultCode::Success);
+  for (const std::string path : {"/", "/shared2", "/shared2/a"})
+    check_stats(path);
+
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/shared2/a/f", 0, modes), ResultCode::Success);
+  {
+    const Result<FileHandle> file = m_fs->OpenFile(Uid{0}, Gid{0}, "/shared2/a/f", Mode::Write);
+    ASSERT_TRUE(file.Succeeded());
+    file->Write(std::vector<u8>(20000).data(), 20000);
+  }
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/shared2/a/b", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/shared2/a/b/g", 0, modes), ResultCode::Success);
+  for (const std::string path : {"/", "/shared2", "/shared2/a", "/shared2/a/b"})
+    check_stats(path);
+
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/shared2/a/b", "/shared2/c"), ResultCode::Success);
+  for (const std::string path : {"/", "/shared2", "/shared2/a", "/shared2/c"})
+    check_stats(path);
+
+  ASSERT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/shared2/a"), ResultCode::Success);
+  for (const std::string path : {"/", "/shared2", "/shared2/c"})
+    check_stats(path);
+}
+
+TEST_F(FileSystemTest, MetadataIsKept)
+{
+  constexpr Modes new_modes{Mode::ReadWrite, Mode::Read, Mode::Read};
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/shared2/f", 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->SetMetadata(0, "/shared2/f", 0x1000, 1, 0, new_modes), ResultCode::Success);
+
+  // The FST may be written lazily, but it must not get lost.
+  m_fs.reset();
+  m_fs = IOS::HLE::Kernel{}.GetFS();
+
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/shared2/f");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->uid, 0x1000u);
+  EXPECT_EQ(metadata->gid, 1);
+  EXPECT_EQ(metadata->modes, new_modes);
+}
+
 // Files need to be explicitly created using CreateFile or CreateDirectory.
 // Automatically creating them on first use would be a bug.
 TEST_F(FileSystemTest, NonExistingFiles)
@@ -346,6 +400,44 @@ TEST_F(FileSystemTest, WriteAndSimpleReadback)
   EXPECT_EQ(TEST_DATA, read_buffer);
 }
 
+TEST_F(FileSystemTest, SmallWritesAndReads)
+{
+  ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/f", 0, modes), ResultCode::Success);
+
+  const Result<FileHandle> writer = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::ReadWrite);
+  const Result<FileHandle> reader = m_fs->OpenFile(Uid{0}, Gid{0}, "/tmp/f", Mode::Read);
+  ASSERT_TRUE(writer.Succeeded());
+  ASSERT_TRUE(reader.Succeeded());
+
+  // Interleave small accesses, which are mostly buffered, with accesses from another handle.
+  std::array<u8, 32> block;
+  for (u8 i = 0; i < 100; ++i)
+  {
+    block.fill(i);
+    ASSERT_TRUE(writer->Write(block.data(), block.size()).Succeeded());
+
+    std::array<u8, 32> read_block;
+    ASSERT_TRUE(reader->Read(read_block.data(), read_block.size()).Succeeded());
+    EXPECT_EQ(read_block, block);
+  }
+
+  // Data which hasn't been flushed yet must be accounted for.
+  const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/f");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->size, 3200u);
+
+  // Overwrite a block in the middle, and switch between reading and writing on the same handle.
+  block.fill(0xff);
+  ASSERT_TRUE(writer->Seek(320, SeekMode::Set).Succeeded());
+  ASSERT_TRUE(writer->Write(block.data(), block.size()).Succeeded());
+  std::array<u8, 32> read_block;
+  ASSERT_TRUE(writer->Read(read_block.data(), read_block.size()).Succeeded());
+  EXPECT_EQ(read_block[0], 11u);
+  ASSERT_TRUE(reader->Seek(320, SeekMode::Set).Succeeded());
+  ASSERT_TRUE(reader->Read(read_block.data(), read_block.size()).Succeeded());
+  EXPECT_EQ(read_block, block);
+}
+
 TEST_F(FileSystemTest, WriteAndRead)
 {
   const std::vector<u8> TEST_DATA{{0xf, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
@@ -0,0 +1,184 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "Common/Assembler/GekkoAssembler.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Checks the CachedInterpreter's fused instruction sequences against the interpreter.
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00010000;
+constexpr u32 STOP_ADDRESS = 0x00008000;
+constexpr u32 DATA_ADDRESS = 0x00100000;
+constexpr int MAX_STEPS = 100000;
+
+constexpr std::string_view FUSED_SEQUENCES = R"(
+  lis r3, 0x10
+  addi r3, r3, 0x100
+  lis r4, 0x1234
+  ori r4, r4, 0x5678
+  addi r5, r3, 0x10
+  lwz r6, 4(r5)
+  rlwinm r8, r6, 4, 0, 27
+  rlwinm r9, r8, 28, 4, 31
+  li r10, 0
+loop:
+  addi r10, r10, 1
+  cmpwi r10, 5
+  blt loop
+  cmplwi r10, 5
+  beq done
+  li r11, 1
+done:
+  blr
+)";
+
+// addi and lwz with rA = 0 use a literal 0 instead of r0, so these must not be fused.
+constexpr std::string_view R0_SEQUENCES = R"(
+  lis r0, 0x10
+  addi r0, r0, 0x20
+  mr r3, r0
+  lis r4, 0x10
+  addi r0, r4, 0x108
+  lwz r5, 0x100(r0)
+  blr
+)";
+
+using GPRs = std::array<u32, 32>;
+
+class CachedInterpreterTest : public testing::Test
+{
+protected:
+  CachedInterpreterTest()
+      : m_system(Core::System::GetInstance()), m_profile_path(File::CreateTempDir())
+  {
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_profile_path.empty());
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    m_system.GetMemory().Init();
+    m_system.GetPowerPC().Init(PowerPC::CPUCore::CachedInterpreter);
+    m_system.GetCoreTiming().Init();
+
+    auto& memory = m_system.GetMemory();
+    memory.Write_U32(0x01234567, 0x100);
+    memory.Write_U32(0x89ABCDEF, DATA_ADDRESS + 0x108);
+    memory.Write_U32(0x13579BDF, DATA_ADDRESS + 0x114);
+  }
+
+  void TearDown() override
+  {
+    m_system.GetCoreTiming().Shutdown();
+    m_system.GetPowerPC().Shutdown();
+    m_system.GetMemory().Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  void LoadGuest(std::string_view assembly)
+  {
+    const auto blocks = Common::GekkoAssembler::Assemble(assembly, CODE_ADDRESS);
+    ASSERT_FALSE(Common::GekkoAssembler::IsFailure(blocks));
+
+    auto& memory = m_system.GetMemory();
+    for (const auto& block : Common::GekkoAssembler::GetT(blocks))
+      memory.CopyToEmu(block.block_address, block.instructions.data(), block.instructions.size());
+  }
+
+  void ResetState()
+  {
+    auto& ppc_state = m_system.GetPPCState();
+    for (u32 i = 0; i < std::size(ppc_state.gpr); i++)
+      ppc_state.gpr[i] = 0xDEAD0000 | i;
+    LR(ppc_state) = STOP_ADDRESS;
+    ppc_state.pc = CODE_ADDRESS;
+    ppc_state.npc = CODE_ADDRESS;
+    ppc_state.iCache.Reset(m_system.GetJitInterface());
+  }
+
+  GPRs GetGPRs() const
+  {
+    GPRs gprs;
+    const auto& ppc_state = m_system.GetPPCState();
+    std::copy(std::begin(ppc_state.gpr), std::end(ppc_state.gpr), gprs.begin());
+    return gprs;
+  }
+
+  GPRs RunInterpreter()
+  {
+    ResetState();
+    auto& ppc_state = m_system.GetPPCState();
+    auto& interpreter = m_system.GetInterpreter();
+    for (int i = 0; i < MAX_STEPS && ppc_state.pc != STOP_ADDRESS; i++)
+      interpreter.SingleStepInner();
+    EXPECT_EQ(STOP_ADDRESS, ppc_state.pc);
+    return GetGPRs();
+  }
+
+  GPRs RunCachedInterpreter()
+  {
+    ResetState();
+    auto& ppc_state = m_system.GetPPCState();
+    auto* const core = m_system.GetJitInterface().GetCore();
+    EXPECT_NE(nullptr, core);
+    if (!core)
+      return {};
+    for (int i = 0; i < MAX_STEPS && ppc_state.pc != STOP_ADDRESS; i++)
+      core->SingleStep();
+    EXPECT_EQ(STOP_ADDRESS, ppc_state.pc);
+    return GetGPRs();
+  }
+
+  Core::System& m_system;
+  std::string m_profile_path;
+};
+}  // namespace
+
+TEST_F(CachedInterpreterTest, FusedSequences)
+{
+  LoadGuest(FUSED_SEQUENCES);
+  const GPRs expected = RunInterpreter();
+  EXPECT_EQ(DATA_ADDRESS + 0x100, expected[3]);
+  EXPECT_EQ(0x12345678u, expected[4]);
+  EXPECT_EQ(0x13579BDFu, expected[6]);
+  EXPECT_EQ(5u, expected[10]);
+
+  EXPECT_EQ(expected, RunCachedInterpreter());
+}
+
+TEST_F(CachedInterpreterTest, R0Sequences)
+{
+  LoadGuest(R0_SEQUENCES);
+  const GPRs expected = RunInterpreter();
+  EXPECT_EQ(0x20u, expected[3]);
+  EXPECT_EQ(DATA_ADDRESS + 0x108, expected[0]);
+  EXPECT_EQ(0x01234567u, expected[5]);
+
+  EXPECT_EQ(expected, RunCachedInterpreter());
+}
@@ -0,0 +1,211 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Common/Assembler/GekkoAssembler.h"
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Config/SessionSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+
+// Checks Jit64's floating point multiplies against the interpreter.
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00010000;
+constexpr u32 STOP_ADDRESS = 0x00008000;
+constexpr int MAX_STEPS = 100;
+
+// Multiplying by f31 (1.0) first makes the analyzer treat the inputs as singles, which takes the
+// path that doesn't round the inputs.
+constexpr std::string_view PAIRED_MULTIPLIES = R"(
+  ps_muls0 f10, f1, f2
+  ps_muls1 f11, f1, f2
+  ps_muls0 f12, f4, f2
+  ps_muls1 f13, f2, f4
+  ps_muls0 f14, f5, f6
+  ps_mul f2, f2, f31
+  ps_mul f4, f4, f31
+  ps_muls0 f15, f1, f2
+  ps_muls1 f16, f1, f2
+  ps_muls1 f17, f1, f4
+  ps_muls0 f18, f4, f1
+  ps_muls0 f19, f5, f6
+  ps_muls0 f3, f3, f2
+  ps_muls1 f2, f1, f2
+  blr
+)";
+
+// The products are exact, so the interpreter's fused results match the separate multiply and
+// add that Jit64 uses with FMA disabled.
+constexpr std::string_view MULTIPLY_ADDS = R"(
+  fmadd f10, f1, f2, f3
+  fmsub f11, f1, f2, f3
+  fnmadd f12, f1, f2, f3
+  fnmsub f13, f1, f2, f3
+  fmadds f14, f1, f2, f3
+  ps_madd f15, f1, f2, f3
+  ps_msub f16, f1, f2, f3
+  fmadd f17, f4, f2, f3
+  fmadd f18, f1, f2, f4
+  fnmadd f19, f5, f6, f3
+  fmadd f1, f1, f2, f1
+  fmsub f2, f3, f2, f3
+  blr
+)";
+
+using FPRs = std::array<std::pair<u64, u64>, 32>;
+
+class Jit64Test : public testing::Test
+{
+protected:
+  Jit64Test() : m_system(Core::System::GetInstance()), m_profile_path(File::CreateTempDir()) {}
+
+  void SetUp() override
+  {
+    // Only the AVX forms of the multiplies differ from the SSE code that was there before.
+    if (!cpu_info.bAVX)
+      GTEST_SKIP() << "Host does not support AVX";
+
+    ASSERT_FALSE(m_profile_path.empty());
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    Config::SetCurrent(Config::MAIN_ACCURATE_NANS, true);
+    Config::SetCurrent(Config::SESSION_USE_FMA, false);
+    Config::SetCurrent(Config::MAIN_FASTMEM_ARENA, false);
+    // Makes the dispatcher return after every block, as the CPU is not running.
+    Config::SetCurrent(Config::MAIN_ENABLE_DEBUGGING, true);
+    m_system.GetMemory().Init();
+    m_system.GetPowerPC().Init(PowerPC::CPUCore::JIT64);
+    m_system.GetCoreTiming().Init();
+    m_initialized = true;
+  }
+
+  void TearDown() override
+  {
+    if (m_initialized)
+    {
+      m_system.GetCoreTiming().Shutdown();
+      m_system.GetPowerPC().Shutdown();
+      m_system.GetMemory().Shutdown();
+      SConfig::Shutdown();
+      Config::Shutdown();
+      Core::UndeclareAsCPUThread();
+    }
+    File::DeleteDirRecursively(m_profile_path);
+  }
+
+  void LoadGuest(std::string_view assembly)
+  {
+    const auto blocks = Common::GekkoAssembler::Assemble(assembly, CODE_ADDRESS);
+    ASSERT_FALSE(Common::GekkoAssembler::IsFailure(blocks));
+
+    auto& memory = m_system.GetMemory();
+    for (const auto& block : Common::GekkoAssembler::GetT(blocks))
+      memory.CopyToEmu(block.block_address, block.instructions.data(), block.instructions.size());
+  }
+
+  void ResetState()
+  {
+    auto& ppc_state = m_system.GetPPCState();
+    for (u32 i = 0; i < std::size(ppc_state.ps); i++)
+      ppc_state.ps[i].SetBoth(static_cast<double>(i), -static_cast<double>(i));
+    ppc_state.ps[1].SetBoth(1.5, 0.5);
+    ppc_state.ps[2].SetBoth(-2.25, 4.0);
+    ppc_state.ps[3].SetBoth(3.0, -1.0);
+    ppc_state.ps[4].SetBoth(u64{0x7FF8123400000000}, u64{0xFFFC567800000000});
+    ppc_state.ps[5].Fill(std::numeric_limits<double>::infinity());
+    ppc_state.ps[6].Fill(0.0);
+    ppc_state.ps[31].Fill(1.0);
+
+    ppc_state.msr.FP = 1;
+    HID2(ppc_state).PSE = 1;
+    ppc_state.fpscr = 0;
+    LR(ppc_state) = STOP_ADDRESS;
+    ppc_state.pc = CODE_ADDRESS;
+    ppc_state.npc = CODE_ADDRESS;
+    ppc_state.iCache.Reset(m_system.GetJitInterface());
+  }
+
+  FPRs GetFPRs() const
+  {
+    FPRs fprs;
+    const auto& ppc_state = m_system.GetPPCState();
+    for (size_t i = 0; i < fprs.size(); i++)
+      fprs[i] = {ppc_state.ps[i].PS0AsU64(), ppc_state.ps[i].PS1AsU64()};
+    return fprs;
+  }
+
+  FPRs RunInterpreter()
+  {
+    ResetState();
+    auto& ppc_state = m_system.GetPPCState();
+    auto& interpreter = m_system.GetInterpreter();
+    for (int i = 0; i < MAX_STEPS && ppc_state.pc != STOP_ADDRESS; i++)
+      interpreter.SingleStepInner();
+    EXPECT_EQ(STOP_ADDRESS, ppc_state.pc);
+    return GetFPRs();
+  }
+
+  FPRs RunJit()
+  {
+    ResetState();
+    auto& ppc_state = m_system.GetPPCState();
+    auto* const jit = m_system.GetJitInterface().GetCore();
+    EXPECT_NE(nullptr, jit);
+    if (!jit)
+      return {};
+    for (int i = 0; i < MAX_STEPS && ppc_state.pc != STOP_ADDRESS; i++)
+      jit->SingleStep();
+    EXPECT_EQ(STOP_ADDRESS, ppc_state.pc);
+    return GetFPRs();
+  }
+
+  void ExpectSameResults()
+  {
+    const FPRs expected = RunInterpreter();
+    const FPRs actual = RunJit();
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+      EXPECT_EQ(expected[i].first, actual[i].first) << "f" << i << " ps0";
+      EXPECT_EQ(expected[i].second, actual[i].second) << "f" << i << " ps1";
+    }
+  }
+
+  Core::System& m_system;
+  std::string m_profile_path;
+  bool m_initialized = false;
+};
+}  // namespace
+
+TEST_F(Jit64Test, PairedMultiplyScalar)
+{
+  LoadGuest(PAIRED_MULTIPLIES);
+  ExpectSameResults();
+}
+
+TEST_F(Jit64Test, MultiplyAddWithoutFMA)
+{
+  LoadGuest(MULTIPLY_ADDS);
+  ExpectSameResults();
+}
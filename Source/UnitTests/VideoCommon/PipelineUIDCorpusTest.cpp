@@ -0,0 +1,121 @@
+// Copyright 2025 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+using VideoCommon::GX_PIPELINE_UID_CACHE_MAGIC;
+using VideoCommon::GX_PIPELINE_UID_VERSION;
+using VideoCommon::SerializedGXPipelineUid;
+
+namespace
+{
+SerializedGXPipelineUid MakeUID(u32 id)
+{
+  SerializedGXPipelineUid uid{};
+  uid.blending_state_bits = id;
+  return uid;
+}
+
+std::vector<u32> GetIDs(const std::vector<SerializedGXPipelineUid>& uids)
+{
+  std::vector<u32> ids;
+  for (const SerializedGXPipelineUid& uid : uids)
+    ids.push_back(uid.blending_state_bits);
+  return ids;
+}
+}  // namespace
+
+class PipelineUIDCorpusTest : public testing::Test
+{
+protected:
+  PipelineUIDCorpusTest() : m_cache_dir(File::CreateTempDir() + "/") {}
+
+  ~PipelineUIDCorpusTest() override
+  {
+    if (m_cache_dir != "/")
+      File::DeleteDirRecursively(m_cache_dir);
+  }
+
+  void SetUp() override
+  {
+    if (m_cache_dir == "/")
+      FAIL();
+  }
+
+  void WriteUIDCache(const std::string& game_id, const std::vector<u32>& ids,
+                     u32 version = GX_PIPELINE_UID_VERSION)
+  {
+    File::IOFile file(m_cache_dir + game_id + ".uidcache", "wb");
+    file.WriteBytes(&GX_PIPELINE_UID_CACHE_MAGIC, sizeof(GX_PIPELINE_UID_CACHE_MAGIC));
+    file.WriteBytes(&version, sizeof(version));
+    for (u32 id : ids)
+    {
+      const SerializedGXPipelineUid uid = MakeUID(id);
+      file.WriteBytes(&uid, sizeof(uid));
+    }
+  }
+
+  std::vector<u32> GetSharedIDs(size_t max_count = 100, const std::string& game_id = "GAME00")
+  {
+    return GetIDs(
+        VideoCommon::PipelineUIDCorpus::GetSharedPipelineUIDs(m_cache_dir, game_id, max_count));
+  }
+
+  const std::string m_cache_dir;
+};
+
+TEST_F(PipelineUIDCorpusTest, RanksByNumberOfTitles)
+{
+  // Repeats within a title don't count
+  WriteUIDCache("GAME01", {1, 2, 3, 4, 4, 4});
+  WriteUIDCache("GAME02", {3, 2, 5});
+  WriteUIDCache("GAME03", {2, 6, 5, 3});
+  WriteUIDCache("GAME04", {2, 7});
+
+  EXPECT_EQ((std::vector<u32>{2, 3, 5}), GetSharedIDs());
+  EXPECT_EQ((std::vector<u32>{2, 3}), GetSharedIDs(2));
+  EXPECT_TRUE(File::Exists(m_cache_dir + VideoCommon::PipelineUIDCorpus::CORPUS_FILENAME));
+}
+
+TEST_F(PipelineUIDCorpusTest, IgnoresOutdatedCaches)
+{
+  WriteUIDCache("GAME01", {1, 2});
+  WriteUIDCache("GAME02", {1, 2});
+  WriteUIDCache("GAME03", {2, 3}, GX_PIPELINE_UID_VERSION - 1);
+  WriteUIDCache("GAME04", {3});
+
+  EXPECT_EQ((std::vector<u32>{1, 2}), GetSharedIDs());
+}
+
+TEST_F(PipelineUIDCorpusTest, RebuildsWhenCachesChange)
+{
+  WriteUIDCache("GAME01", {1, 2});
+  WriteUIDCache("GAME02", {1});
+  EXPECT_EQ((std::vector<u32>{1}), GetSharedIDs());
+  EXPECT_EQ((std::vector<u32>{1}), GetSharedIDs());
+
+  WriteUIDCache("GAME02", {1, 2});
+  WriteUIDCache("GAME03", {2});
+  EXPECT_EQ((std::vector<u32>{2, 1}), GetSharedIDs());
+}
+
+TEST_F(PipelineUIDCorpusTest, IgnoresRunningTitleCacheChanges)
+{
+  WriteUIDCache("GAME01", {1, 2});
+  WriteUIDCache("GAME02", {1});
+  EXPECT_EQ((std::vector<u32>{1}), GetSharedIDs(100, "GAME02"));
+
+  // The corpus is reused while only the running title has recorded new UIDs
+  WriteUIDCache("GAME02", {1, 2});
+  EXPECT_EQ((std::vector<u32>{1}), GetSharedIDs(100, "GAME02"));
+  EXPECT_EQ((std::vector<u32>{1, 2}), GetSharedIDs(100, "GAME01"));
+}
@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <bit>
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <random>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
@@ -15,8 +18,10 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoader.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoaderSpecialized.h"
 
 TEST(VertexLoaderUID, UniqueEnough)
 {
@@ -1077,6 +1082,193 @@ TEST_P(VertexLoaderSkippedTexCoordsTest, SkippedTextures)
   }
 }
 
+class VertexLoaderSpecializedTest : public VertexLoaderTest
+{
+protected:
+  // Runs a specialized loader and the generic pipeline over the same pseudo-random input (and
+  // arrays) and checks that they produce identical output. skip_offset is the offset of a 16-bit
+  // position index within a vertex, which gets set to 0xFFFF on a few vertices to skip them.
+  void CompareWithGeneric(int count, std::optional<u32> skip_offset = std::nullopt)
+  {
+    std::unique_ptr<VertexLoaderBase> specialized =
+        VertexLoaderSpecialized::Create(m_vtx_desc, m_vtx_attr);
+    ASSERT_NE(specialized, nullptr);
+    VertexLoader generic(m_vtx_desc, m_vtx_attr);
+    ASSERT_EQ(specialized->m_vertex_size, generic.m_vertex_size);
+    ASSERT_EQ(specialized->m_native_vtx_decl.stride, generic.m_native_vtx_decl.stride);
+
+    std::mt19937 rng(count);
+    for (u8& byte : input_memory)
+      byte = static_cast<u8>(rng());
+    if (skip_offset)
+    {
+      for (int i = 3; i < count; i += 7)
+        std::memset(&input_memory[i * generic.m_vertex_size + *skip_offset], 0xFF, sizeof(u16));
+    }
+    for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+    {
+      VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] =
+          input_memory + sizeof(input_memory) / 2;
+      g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 13 + i;
+    }
+
+    // Skipped vertices leave the caches untouched, so start both loaders from the same state
+    const auto reset_caches = [] {
+      VertexLoaderManager::position_cache = {};
+      VertexLoaderManager::position_matrix_index_cache = {};
+      VertexLoaderManager::normal_cache = {};
+    };
+
+    u8* const generic_out = output_memory;
+    u8* const specialized_out = output_memory + sizeof(output_memory) / 2;
+    reset_caches();
+    const int generic_count = generic.RunVertices(input_memory, generic_out, count);
+    const auto generic_position_cache = VertexLoaderManager::position_cache;
+    const auto generic_posmtx_cache = VertexLoaderManager::position_matrix_index_cache;
+    const auto generic_normal_cache = VertexLoaderManager::normal_cache;
+
+    reset_caches();
+    const int specialized_count = specialized->RunVertices(input_memory, specialized_out, count);
+    ASSERT_EQ(specialized_count, generic_count);
+    EXPECT_EQ(0, std::memcmp(generic_out, specialized_out,
+                             generic_count * generic.m_native_vtx_decl.stride));
+    EXPECT_EQ(0, std::memcmp(&VertexLoaderManager::position_cache, &generic_position_cache,
+                             sizeof(generic_position_cache)));
+    EXPECT_EQ(VertexLoaderManager::position_matrix_index_cache, generic_posmtx_cache);
+    EXPECT_EQ(0, std::memcmp(&VertexLoaderManager::normal_cache, &generic_normal_cache,
+                             sizeof(generic_normal_cache)));
+  }
+
+  // Layout of the indexed model formats used by Metroid Prime
+  void SetUpIndexedModel()
+  {
+    m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+    m_vtx_desc.low.Normal = VertexComponentFormat::Index16;
+    m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+    m_vtx_desc.high.Tex1Coord = VertexComponentFormat::Index16;
+    m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+    m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+    m_vtx_attr.g0.NormalFormat = ComponentFormat::Short;
+    m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+    m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::UShort;
+    m_vtx_attr.g0.Tex0Frac = 15;
+    m_vtx_attr.g1.Tex1CoordElements = TexComponentCount::ST;
+    m_vtx_attr.g1.Tex1CoordFormat = ComponentFormat::Float;
+  }
+};
+
+TEST_F(VertexLoaderSpecializedTest, DirectFloatColorTexCoord)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Float;
+  CompareWithGeneric(1000);
+}
+
+TEST_F(VertexLoaderSpecializedTest, DirectShortWithFrac)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.PosFrac = 5;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0Frac = 8;
+  CompareWithGeneric(1000);
+}
+
+TEST_F(VertexLoaderSpecializedTest, IndexedModel)
+{
+  SetUpIndexedModel();
+  CompareWithGeneric(1000, 0);
+}
+
+TEST_F(VertexLoaderSpecializedTest, IndexedModelWithPosMtx)
+{
+  m_vtx_desc.low.PosMatIdx = true;
+  m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Index16;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.PosFrac = 12;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Byte;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0Frac = 10;
+  CompareWithGeneric(1000, 1);
+}
+
+TEST_F(VertexLoaderSpecializedTest, Index8)
+{
+  // With 8-bit indices, random input hits the skip index (0xFF) by itself
+  m_vtx_desc.low.Position = VertexComponentFormat::Index8;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Index8;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Index8;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Byte;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  CompareWithGeneric(1000);
+}
+
+TEST_F(VertexLoaderSpecializedTest, UnsupportedFormats)
+{
+  SetUpIndexedModel();
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::NTB;
+  EXPECT_EQ(VertexLoaderSpecialized::Create(m_vtx_desc, m_vtx_attr), nullptr);
+
+  SetUpIndexedModel();
+  m_vtx_desc.low.Tex0MatIdx = true;
+  EXPECT_EQ(VertexLoaderSpecialized::Create(m_vtx_desc, m_vtx_attr), nullptr);
+
+  SetUpIndexedModel();
+  m_vtx_desc.high.Tex2Coord = VertexComponentFormat::Index16;
+  EXPECT_EQ(VertexLoaderSpecialized::Create(m_vtx_desc, m_vtx_attr), nullptr);
+}
+
+class VertexLoaderSpecializedSpeedTest : public VertexLoaderSpecializedTest,
+                                         public ::testing::WithParamInterface<bool>
+{
+};
+INSTANTIATE_TEST_SUITE_P(GenericAndSpecialized, VertexLoaderSpecializedSpeedTest,
+                         ::testing::Values(false, true));
+
+TEST_P(VertexLoaderSpecializedSpeedTest, IndexedModel)
+{
+  // Compare the time taken by the two instances to see how much faster the specialized loader is.
+  const bool specialized = GetParam();
+  fmt::print("specialized: {}\n", specialized);
+  SetUpIndexedModel();
+  if (specialized)
+    m_loader = VertexLoaderSpecialized::Create(m_vtx_desc, m_vtx_attr);
+  else
+    m_loader = std::make_unique<VertexLoader>(m_vtx_desc, m_vtx_attr);
+  ASSERT_NE(m_loader, nullptr);
+  ASSERT_EQ(8u, m_loader->m_vertex_size);
+  ASSERT_EQ(40, m_loader->m_native_vtx_decl.stride);
+
+  for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+  {
+    VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = m_src.GetPointer();
+    g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 129;
+  }
+
+  for (int i = 0; i < 1000; ++i)
+    RunVertices(100000);
+}
+
 // For gtest, which doesn't know about our fmt::formatters by default
 static void PrintTo(const VertexComponentFormat& t, std::ostream* os)
 {